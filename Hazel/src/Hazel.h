@@ -9,6 +9,8 @@
 #include "Hazel/Core/Log.h"
 
 #include "Hazel/Core/Timestep.h"
+#include "Hazel/Core/Time.h"
+#include "Hazel/Core/JobSystem.h"
 
 #include "Hazel/Core/Input.h"
 #include "Hazel/Core/KeyCodes.h"
@@ -21,10 +23,16 @@
 #include "Hazel/Renderer/Renderer.h"
 #include "Hazel/Renderer/Renderer2D.h"
 #include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/RenderThread.h"
 
 #include "Hazel/Renderer/Buffer.h"
 #include "Hazel/Renderer/Shader.h"
 #include "Hazel/Renderer/Texture.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+#include "Hazel/Renderer/TextureAtlas.h"
+#include "Hazel/Renderer/TextureCooker.h"
+#include "Hazel/Renderer/TextureResidency.h"
+#include "Hazel/Renderer/AssetManager.h"
 #include "Hazel/Renderer/VertexArray.h"
 
 #include "Hazel/Renderer/OrthographicCamera.h"
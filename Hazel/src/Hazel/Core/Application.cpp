@@ -2,13 +2,17 @@
 #include "Hazel/Core/Application.h"
 
 #include "Hazel/Core/Log.h"
+#include "Hazel/Core/JobSystem.h"
+#include "Hazel/Core/Time.h"
 
 #include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Renderer/ShaderReloader.h"
+#include "Hazel/Renderer/TextureLoader.h"
+#include "Hazel/Renderer/TextureResidency.h"
 
 #include "Hazel/Core/Input.h"
 
-#include <glfw/glfw3.h>
-
 namespace Hazel {
 
 	Application* Application::s_Instance = nullptr;
@@ -22,10 +26,14 @@ namespace Hazel {
 		m_Window = Window::Create();
 		m_Window->SetEventCallback(HZ_BIND_EVENT_FN(Application::OnEvent));
 
+		JobSystem::Init();
 		Renderer::Init();
 
 		m_ImGuiLayer = new ImGuiLayer();
 		PushOverlay(m_ImGuiLayer);
+
+		SetFixedUpdateRate(60);
+		m_StartTime = m_LastFrameTime = Time::GetNanoseconds();
 	}
 
 	Application::~Application()
@@ -33,6 +41,7 @@ namespace Hazel {
 		HZ_PROFILE_FUNCTION();
 
 		Renderer::Shutdown();
+		JobSystem::Shutdown();
 	}
 
 	void Application::PushLayer(Layer* layer)
@@ -71,16 +80,48 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
+		if (m_RenderThreadEnabled)
+			RenderThread::Start(m_Window->GetContext());
+
 		while (m_Running)
 		{
 			HZ_PROFILE_SCOPE("RunLoop");
 
-			float time = (float)glfwGetTime();
-			Timestep timestep = time - m_LastFrameTime;
+			uint64_t time = Time::GetNanoseconds();
+			uint64_t frameTime = time - m_LastFrameTime;
+			Timestep timestep = (float)(frameTime * 1e-9);
 			m_LastFrameTime = time;
 
+			// Swap in edited shaders and finished textures before anything is recorded this frame
+			RenderThread::Submit([]()
+			{
+				ShaderReloader::Update();
+				TextureLoader::Update();
+				TextureResidency::Update();
+			});
+
 			if (!m_Minimized)
 			{
+				if (m_FixedTimestep)
+				{
+					HZ_PROFILE_SCOPE("LayerStack OnFixedUpdate");
+
+					uint64_t maxAccumulated = m_FixedTimestep * m_MaxFixedStepsPerFrame;
+					m_FixedUpdateAccumulator = std::min(m_FixedUpdateAccumulator + frameTime, maxAccumulated);
+
+					Timestep fixedTimestep = (float)(m_FixedTimestep * 1e-9);
+					while (m_FixedUpdateAccumulator >= m_FixedTimestep)
+					{
+						for (Layer* layer : m_LayerStack)
+							layer->OnFixedUpdate(fixedTimestep);
+						m_FixedUpdateAccumulator -= m_FixedTimestep;
+					}
+
+					m_FixedUpdateAlpha = (float)((double)m_FixedUpdateAccumulator / m_FixedTimestep);
+				}
+
+				m_LayerStack.ParallelUpdate(timestep);
+
 				{
 					HZ_PROFILE_SCOPE("LayerStack OnUpdate");
 
@@ -98,8 +139,29 @@ namespace Hazel {
 				m_ImGuiLayer->End();
 			}
 
+			Renderer::EndFrame();
 			m_Window->OnUpdate();
+
+			// Waits for the render thread to finish the previous frame, then hands it this one
+			RenderThread::EndFrame();
+
+			m_FrameLimiter.Wait();
 		}
+
+		RenderThread::Stop();
+	}
+
+	void Application::SetFixedUpdateRate(uint32_t stepsPerSecond)
+	{
+		m_FixedUpdateRate = stepsPerSecond;
+		m_FixedTimestep = stepsPerSecond ? 1000000000ull / stepsPerSecond : 0;
+		m_FixedUpdateAccumulator = 0;
+		m_FixedUpdateAlpha = 0.0f;
+	}
+
+	double Application::GetTime() const
+	{
+		return (Time::GetNanoseconds() - m_StartTime) * 1e-9;
 	}
 
 	bool Application::OnWindowClose(WindowCloseEvent& e)
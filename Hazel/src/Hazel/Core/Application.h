@@ -3,6 +3,7 @@
 #include "Hazel/Core/Core.h"
 
 #include "Hazel/Core/Window.h"
+#include "Hazel/Core/FrameLimiter.h"
 #include "Hazel/Core/LayerStack.h"
 #include "Hazel/Events/Event.h"
 #include "Hazel/Events/ApplicationEvent.h"
@@ -28,6 +29,32 @@ namespace Hazel {
 
 		inline Window& GetWindow() { return *m_Window; }
 
+		// Rate of Layer::OnFixedUpdate in steps per second; 0 turns fixed updates off
+		void SetFixedUpdateRate(uint32_t stepsPerSecond);
+		uint32_t GetFixedUpdateRate() const { return m_FixedUpdateRate; }
+		// Steps run in one frame are capped, so a frame that took too long is not followed
+		// by ever longer ones; the simulated time that did not fit is dropped
+		void SetMaxFixedStepsPerFrame(uint32_t maxSteps) { m_MaxFixedStepsPerFrame = maxSteps; }
+
+		// How far the current frame is between the last fixed step and the next one, in
+		// [0, 1); renderers blend the previous and current simulation state by it
+		float GetFixedUpdateAlpha() const { return m_FixedUpdateAlpha; }
+
+		// Render on a dedicated thread that owns the graphics context and executes the
+		// commands of the previous frame while this one is recorded. Read when Run starts.
+		// In this mode graphics API work outside the renderer, such as calling a shader's
+		// Set functions or a texture's SetData, must go through RenderThread::Submit.
+		void SetRenderThreadEnabled(bool enabled) { m_RenderThreadEnabled = enabled; }
+		bool IsRenderThreadEnabled() const { return m_RenderThreadEnabled; }
+
+		// Caps the main loop at a fixed rate, independent of vsync; 0 runs it unlimited
+		void SetTargetFrameRate(uint32_t framesPerSecond) { m_FrameLimiter.SetTargetFrameRate(framesPerSecond); }
+		uint32_t GetTargetFrameRate() const { return m_FrameLimiter.GetTargetFrameRate(); }
+		const FrameLimiter::Statistics& GetFrameLimiterStats() const { return m_FrameLimiter.GetStats(); }
+
+		// Seconds since the application started
+		double GetTime() const;
+
 		inline static Application& Get() { return *s_Instance; }
 	private:
 		void Run();
@@ -39,7 +66,18 @@ namespace Hazel {
 		bool m_Running = true;
 		bool m_Minimized = false;
 		LayerStack m_LayerStack;
-		float m_LastFrameTime = 0.0f;
+		// Nanoseconds on a steady clock; a float would lose precision within hours
+		uint64_t m_StartTime = 0;
+		uint64_t m_LastFrameTime = 0;
+
+		uint32_t m_FixedUpdateRate = 0;
+		uint64_t m_FixedTimestep = 0;
+		uint64_t m_FixedUpdateAccumulator = 0;
+		uint32_t m_MaxFixedStepsPerFrame = 8;
+		float m_FixedUpdateAlpha = 0.0f;
+
+		bool m_RenderThreadEnabled = false;
+		FrameLimiter m_FrameLimiter;
 	private:
 		static Application* s_Instance;
 		friend int ::main(int argc, char** argv);
@@ -0,0 +1,21 @@
+#include "hzpch.h"
+#include "Hazel/Core/FileWatcher.h"
+
+#ifdef HZ_PLATFORM_LINUX
+	#include "Platform/Linux/LinuxFileWatcher.h"
+#else
+	#include "Hazel/Core/PollingFileWatcher.h"
+#endif
+
+namespace Hazel {
+
+	Scope<FileWatcher> FileWatcher::Create()
+	{
+	#ifdef HZ_PLATFORM_LINUX
+		return CreateScope<LinuxFileWatcher>();
+	#else
+		return CreateScope<PollingFileWatcher>();
+	#endif
+	}
+
+}
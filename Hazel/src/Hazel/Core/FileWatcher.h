@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <string>
+#include <vector>
+
+namespace Hazel {
+
+	// Reports watched files that changed on disk. Poll() never blocks, so it can be
+	// called once per frame.
+	class FileWatcher
+	{
+	public:
+		virtual ~FileWatcher() = default;
+
+		virtual void Watch(const std::string& filepath) = 0;
+		virtual void Unwatch(const std::string& filepath) = 0;
+
+		// Paths, as passed to Watch, of the files modified since the last call
+		virtual std::vector<std::string> Poll() = 0;
+
+		static Scope<FileWatcher> Create();
+	};
+
+}
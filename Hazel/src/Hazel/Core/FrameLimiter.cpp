@@ -0,0 +1,113 @@
+#include "hzpch.h"
+#include "Hazel/Core/FrameLimiter.h"
+
+#include "Hazel/Core/Time.h"
+
+#include <chrono>
+#include <thread>
+
+#ifdef HZ_PLATFORM_WINDOWS
+	#include <timeapi.h>
+#endif
+
+namespace Hazel {
+
+	// Sleeps are never trusted to wake up closer to the deadline than this
+	static const uint64_t MinSpinMargin = 50000;
+	static const uint64_t InitialSpinMargin = 2000000;
+
+	FrameLimiter::~FrameLimiter()
+	{
+		SetTargetFrameRate(0);
+	}
+
+	void FrameLimiter::SetTargetFrameRate(uint32_t framesPerSecond)
+	{
+	#ifdef HZ_PLATFORM_WINDOWS
+		// The default scheduler tick of ~15.6 ms is coarser than most frames
+		if (framesPerSecond && !m_TargetFrameRate)
+			timeBeginPeriod(1);
+		else if (!framesPerSecond && m_TargetFrameRate)
+			timeEndPeriod(1);
+	#endif
+
+		m_TargetFrameRate = framesPerSecond;
+		m_FramePeriod = framesPerSecond ? 1000000000ull / framesPerSecond : 0;
+		m_NextDeadline = 0;
+		m_SpinMargin = std::min(InitialSpinMargin, m_FramePeriod);
+	}
+
+	void FrameLimiter::Wait()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!m_FramePeriod)
+			return;
+
+		uint64_t now = Time::GetNanoseconds();
+		if (!m_NextDeadline)
+		{
+			// First frame: nothing to wait for yet
+			m_NextDeadline = now + m_FramePeriod;
+			return;
+		}
+
+		m_Stats.Frames++;
+
+		uint64_t deadline = m_NextDeadline;
+		if (now >= deadline)
+		{
+			m_Stats.MissedDeadlines++;
+			m_NextDeadline = now - deadline >= m_FramePeriod ? now + m_FramePeriod : deadline + m_FramePeriod;
+			return;
+		}
+
+		if (deadline - now > m_SpinMargin)
+		{
+			HZ_PROFILE_SCOPE("FrameLimiter Sleep");
+
+			uint64_t wakeTarget = deadline - m_SpinMargin;
+			std::this_thread::sleep_for(std::chrono::nanoseconds(wakeTarget - now));
+			now = Time::GetNanoseconds();
+
+			// Keep twice the worst recent oversleep in hand; grow at once, shrink slowly
+			uint64_t oversleep = now > wakeTarget ? now - wakeTarget : 0;
+			uint64_t wanted = std::min(std::max(oversleep * 2, MinSpinMargin), m_FramePeriod);
+			if (wanted > m_SpinMargin)
+				m_SpinMargin = wanted;
+			else
+				m_SpinMargin -= (m_SpinMargin - wanted) / 8;
+		}
+
+		{
+			HZ_PROFILE_SCOPE("FrameLimiter Spin");
+
+			while (now < deadline)
+			{
+				std::this_thread::yield();
+				now = Time::GetNanoseconds();
+			}
+		}
+
+		float jitter = (float)((now - deadline) * 1e-6);
+		m_JitterSum += jitter;
+		m_Stats.LastJitter = jitter;
+		m_Stats.AverageJitter = (float)(m_JitterSum / (m_Stats.Frames - m_Stats.MissedDeadlines));
+		m_Stats.MaxJitter = std::max(m_Stats.MaxJitter, jitter);
+
+		m_NextDeadline = deadline + m_FramePeriod;
+
+		HZ_PROFILE_COUNTER("FrameLimiter", {
+			{ "JitterUs", (now - deadline) / 1000 },
+			{ "SpinMarginUs", m_SpinMargin / 1000 },
+			{ "MissedDeadlines", m_Stats.MissedDeadlines }
+		});
+	}
+
+	void FrameLimiter::ResetStats()
+	{
+		m_Stats = {};
+		m_JitterSum = 0.0;
+	}
+
+}
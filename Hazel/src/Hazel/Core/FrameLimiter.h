@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+namespace Hazel {
+
+	// Paces a loop to a fixed rate on a monotonic clock. Wait sleeps through most of
+	// the time left in the frame and spins through the rest, as sleeps wake up late by
+	// an amount that varies with the OS timer; the spin margin follows the lateness
+	// actually seen, so an accurate timer costs little CPU.
+	class FrameLimiter
+	{
+	public:
+		struct Statistics
+		{
+			uint64_t Frames = 0;
+			// Frames that were already past their deadline when Wait was called
+			uint64_t MissedDeadlines = 0;
+
+			// How far past its deadline each wait ended, in milliseconds; missed frames
+			// do not wait and are not included
+			float LastJitter = 0.0f;
+			float AverageJitter = 0.0f;
+			float MaxJitter = 0.0f;
+		};
+	public:
+		FrameLimiter() = default;
+		~FrameLimiter();
+
+		// Frames per second; 0 turns the limiter off
+		void SetTargetFrameRate(uint32_t framesPerSecond);
+		uint32_t GetTargetFrameRate() const { return m_TargetFrameRate; }
+
+		// Blocks until the current frame's deadline, then starts the next frame. A frame
+		// that ran late is counted as missed; after one that overran a whole period the
+		// schedule restarts from now rather than rushing the next frames to catch up.
+		void Wait();
+
+		const Statistics& GetStats() const { return m_Stats; }
+		void ResetStats();
+	private:
+		uint32_t m_TargetFrameRate = 0;
+		// Nanoseconds on a steady clock
+		uint64_t m_FramePeriod = 0;
+		uint64_t m_NextDeadline = 0;
+		uint64_t m_SpinMargin = 0;
+
+		Statistics m_Stats;
+		double m_JitterSum = 0.0;
+	};
+
+}
@@ -0,0 +1,321 @@
+#include "hzpch.h"
+#include "Hazel/Core/JobSystem.h"
+
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+namespace Hazel {
+
+	struct Job
+	{
+		std::function<void()> Function;
+		JobCounter* Counter = nullptr;
+	};
+
+	// Chase-Lev work-stealing deque with a fixed capacity (Le et al., "Correct and
+	// Efficient Work-Stealing for Weak Memory Models"). Push and Pop are for the owning
+	// thread only; Steal may be called from any thread.
+	class JobQueue
+	{
+	public:
+		static constexpr int64_t Capacity = 4096;
+
+		bool Push(Job* job)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			if (bottom - top >= Capacity)
+				return false;
+
+			m_Jobs[bottom & (Capacity - 1)].store(job, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			return true;
+		}
+
+		Job* Pop()
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return nullptr;
+			}
+
+			Job* job = m_Jobs[bottom & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (top == bottom)
+			{
+				// Last job: race the thieves for it
+				if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+					job = nullptr;
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+			}
+			return job;
+		}
+
+		Job* Steal()
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+			if (top >= bottom)
+				return nullptr;
+
+			Job* job = m_Jobs[top & (Capacity - 1)].load(std::memory_order_relaxed);
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return nullptr;
+			return job;
+		}
+	private:
+		// Separate cache lines: thieves hammer m_Top, the owner m_Bottom
+		alignas(64) std::atomic<int64_t> m_Top = 0;
+		alignas(64) std::atomic<int64_t> m_Bottom = 0;
+		std::array<std::atomic<Job*>, Capacity> m_Jobs;
+	};
+
+	struct JobSystemData
+	{
+		std::vector<std::thread> Workers;
+		// One per participating thread; index 0 belongs to the thread that called Init
+		std::vector<Scope<JobQueue>> Queues;
+		std::atomic<bool> Running = false;
+
+		// Jobs from threads without a queue, or from a full one
+		std::deque<Job*> SharedQueue;
+		std::mutex SharedMutex;
+
+		// Jobs pushed but not yet taken; idle workers sleep while it is zero
+		std::atomic<uint32_t> QueuedJobs = 0;
+		std::atomic<uint32_t> SleepingWorkers = 0;
+		std::mutex SleepMutex;
+		std::condition_variable WakeCondition;
+	};
+
+	static JobSystemData* s_Data = nullptr;
+	static thread_local int32_t s_QueueIndex = -1;
+
+	static void Enqueue(Job* job)
+	{
+		s_Data->QueuedJobs.fetch_add(1);
+
+		if (s_QueueIndex < 0 || !s_Data->Queues[s_QueueIndex]->Push(job))
+		{
+			std::lock_guard<std::mutex> lock(s_Data->SharedMutex);
+			s_Data->SharedQueue.push_back(job);
+		}
+
+		if (s_Data->SleepingWorkers.load() > 0)
+		{
+			std::lock_guard<std::mutex> lock(s_Data->SleepMutex);
+			s_Data->WakeCondition.notify_one();
+		}
+	}
+
+	static Job* FindJob()
+	{
+		Job* job = nullptr;
+		if (s_QueueIndex >= 0)
+			job = s_Data->Queues[s_QueueIndex]->Pop();
+
+		if (!job)
+		{
+			// Start at a different victim on every thread so thieves spread out
+			uint32_t queueCount = (uint32_t)s_Data->Queues.size();
+			uint32_t start = s_QueueIndex >= 0 ? s_QueueIndex + 1 : 0;
+			for (uint32_t i = 0; i < queueCount && !job; i++)
+			{
+				uint32_t victim = (start + i) % queueCount;
+				if ((int32_t)victim != s_QueueIndex)
+					job = s_Data->Queues[victim]->Steal();
+			}
+		}
+
+		if (!job)
+		{
+			std::lock_guard<std::mutex> lock(s_Data->SharedMutex);
+			if (!s_Data->SharedQueue.empty())
+			{
+				job = s_Data->SharedQueue.front();
+				s_Data->SharedQueue.pop_front();
+			}
+		}
+
+		if (job)
+			s_Data->QueuedJobs.fetch_sub(1);
+		return job;
+	}
+
+	void JobSystem::Execute(Job* job)
+	{
+		job->Function();
+
+		JobCounter* counter = job->Counter;
+		delete job;
+
+		if (!counter)
+			return;
+
+		// While other jobs are pending nobody can be done waiting, so the counter stays alive
+		uint32_t pending = counter->m_Pending.load(std::memory_order_acquire);
+		while (pending > 1)
+		{
+			if (counter->m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel, std::memory_order_acquire))
+				return;
+		}
+
+		// Probably the last one: finish under the lock, which Wait takes before it returns
+		// and the counter may be destroyed
+		std::vector<Job*> continuations;
+		{
+			std::lock_guard<std::mutex> lock(counter->m_Mutex);
+			if (counter->m_Pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				continuations.swap(counter->m_Continuations);
+		}
+
+		for (Job* continuation : continuations)
+		{
+			if (s_Data)
+				Enqueue(continuation);
+			else
+				Execute(continuation);
+		}
+	}
+
+	void JobSystem::WorkerMain(int32_t queueIndex)
+	{
+		s_QueueIndex = queueIndex;
+		HZ_PROFILE_THREAD("Job Worker " + std::to_string(queueIndex));
+
+		while (s_Data->Running.load())
+		{
+			if (Job* job = FindJob())
+			{
+				Execute(job);
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(s_Data->SleepMutex);
+			s_Data->SleepingWorkers.fetch_add(1);
+			s_Data->WakeCondition.wait(lock, [] { return !s_Data->Running.load() || s_Data->QueuedJobs.load() > 0; });
+			s_Data->SleepingWorkers.fetch_sub(1);
+		}
+
+		s_QueueIndex = -1;
+	}
+
+	void JobSystem::Init(uint32_t workerCount)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (workerCount == 0)
+			workerCount = std::max(std::thread::hardware_concurrency(), 2u) - 1;
+
+		s_Data = new JobSystemData();
+		for (uint32_t i = 0; i < workerCount + 1; i++)
+			s_Data->Queues.push_back(CreateScope<JobQueue>());
+
+		s_QueueIndex = 0;
+		HZ_PROFILE_THREAD("Main Thread");
+
+		s_Data->Running = true;
+		for (uint32_t i = 1; i <= workerCount; i++)
+			s_Data->Workers.emplace_back(WorkerMain, (int32_t)i);
+	}
+
+	void JobSystem::Shutdown()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		// Whatever is still queued runs here, so nobody waits on a counter forever
+		while (Job* job = FindJob())
+			Execute(job);
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->SleepMutex);
+			s_Data->Running = false;
+		}
+		s_Data->WakeCondition.notify_all();
+
+		for (auto& worker : s_Data->Workers)
+			worker.join();
+
+		delete s_Data;
+		s_Data = nullptr;
+		s_QueueIndex = -1;
+	}
+
+	void JobSystem::Run(std::function<void()> function, JobCounter* counter, JobCounter* dependency)
+	{
+		if (counter)
+			counter->m_Pending.fetch_add(1, std::memory_order_relaxed);
+
+		Job* job = new Job{ std::move(function), counter };
+
+		if (dependency)
+		{
+			std::lock_guard<std::mutex> lock(dependency->m_Mutex);
+			if (!dependency->IsDone())
+			{
+				dependency->m_Continuations.push_back(job);
+				return;
+			}
+		}
+
+		if (s_Data)
+			Enqueue(job);
+		else
+			Execute(job);
+	}
+
+	void JobSystem::Wait(JobCounter& counter)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		while (!counter.IsDone())
+		{
+			Job* job = s_Data ? FindJob() : nullptr;
+			if (job)
+				Execute(job);
+			else
+				std::this_thread::yield();
+		}
+
+		// The job that finished the counter may still be releasing its continuations
+		std::lock_guard<std::mutex> lock(counter.m_Mutex);
+	}
+
+	void JobSystem::ParallelFor(uint32_t count, uint32_t minChunkSize, const std::function<void(uint32_t begin, uint32_t end)>& function)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (count == 0)
+			return;
+
+		// A few chunks per thread lets stealing even out chunks that take longer
+		uint32_t threadCount = GetWorkerCount() + 1;
+		uint32_t chunkCount = std::min(std::max(count / std::max(minChunkSize, 1u), 1u), threadCount * 4);
+		uint32_t chunkSize = (count + chunkCount - 1) / chunkCount;
+
+		JobCounter counter;
+		for (uint32_t begin = chunkSize; begin < count; begin += chunkSize)
+		{
+			uint32_t end = std::min(begin + chunkSize, count);
+			Run([&function, begin, end]() { function(begin, end); }, &counter);
+		}
+
+		// The first chunk runs here rather than waiting idle
+		function(0, std::min(chunkSize, count));
+		Wait(counter);
+	}
+
+	uint32_t JobSystem::GetWorkerCount()
+	{
+		return s_Data ? (uint32_t)s_Data->Workers.size() : 0;
+	}
+
+}
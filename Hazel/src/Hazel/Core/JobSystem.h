@@ -0,0 +1,65 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+
+namespace Hazel {
+
+	struct Job;
+
+	// Counts the jobs started with it that have not finished yet. Wait on it with
+	// JobSystem::Wait, or pass it as another job's dependency. Only destroy it after a
+	// Wait on it has returned; IsDone alone can turn true while its last job is finishing.
+	class JobCounter
+	{
+	public:
+		JobCounter() = default;
+		JobCounter(const JobCounter&) = delete;
+		JobCounter& operator=(const JobCounter&) = delete;
+
+		bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+	private:
+		std::atomic<uint32_t> m_Pending = 0;
+
+		// Jobs that depend on this counter, released when it reaches zero
+		std::mutex m_Mutex;
+		std::vector<Job*> m_Continuations;
+
+		friend class JobSystem;
+	};
+
+	// Runs small tasks on a pool of worker threads, one per hardware thread with the main
+	// thread counted as one of them. Every worker owns a lock-free deque: it pushes and
+	// pops its own jobs at the bottom while idle workers steal from the top. Waiting
+	// threads run jobs instead of blocking.
+	//
+	// Before Init and after Shutdown jobs run immediately on the calling thread.
+	class JobSystem
+	{
+	public:
+		// Starts workerCount background workers; 0 picks one less than the hardware threads
+		static void Init(uint32_t workerCount = 0);
+		static void Shutdown();
+
+		// counter, if given, counts the job until it has finished. A job with a dependency
+		// only starts once the dependency counter has reached zero.
+		static void Run(std::function<void()> function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+
+		// Runs other jobs on this thread until counter reaches zero
+		static void Wait(JobCounter& counter);
+
+		// Calls function(begin, end) for chunks of [0, count) of at least minChunkSize
+		// elements in parallel, and returns once all of them are done
+		static void ParallelFor(uint32_t count, uint32_t minChunkSize, const std::function<void(uint32_t begin, uint32_t end)>& function);
+
+		// Background workers, not counting the main thread
+		static uint32_t GetWorkerCount();
+	private:
+		static void Execute(Job* job);
+		static void WorkerMain(int32_t queueIndex);
+	};
+
+}
@@ -7,5 +7,15 @@ namespace Hazel {
 		: m_DebugName(debugName)
 	{
 	}
+
+	void Layer::RemoveDependency(Layer* layer)
+	{
+		auto it = std::remove(m_Dependencies.begin(), m_Dependencies.end(), layer);
+		if (it == m_Dependencies.end())
+			return;
+
+		m_Dependencies.erase(it, m_Dependencies.end());
+		m_DependencyVersion++;
+	}
 	
 }
\ No newline at end of file
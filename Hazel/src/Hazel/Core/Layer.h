@@ -15,12 +15,34 @@ namespace Hazel {
 		virtual void OnAttach() {}
 		virtual void OnDetach() {}
 		virtual void OnUpdate(Timestep ts) {}
+		// Called zero or more times before each OnUpdate, always with the same step
+		// (see Application::SetFixedUpdateRate)
+		virtual void OnFixedUpdate(Timestep ts) {}
+		// Runs on a worker thread before OnUpdate, at the same time as the other layers'
+		// OnParallelUpdate except for the layers this one depends on, which have finished.
+		// Must not touch the renderer or ImGui; hand results over to OnUpdate instead.
+		// Layers that keep the default are left out after their first frame.
+		virtual void OnParallelUpdate(Timestep ts) { m_HasParallelUpdate = false; }
 		virtual void OnImGuiRender() {}
 		virtual void OnEvent(Event& event) {}
 
 		inline const std::string& GetName() const { return m_DebugName; }
+
+		// Makes this layer's OnParallelUpdate wait for the given layer's, because it reads
+		// what that one writes or otherwise has to follow it. Layers not on the stack are ignored.
+		void AddDependency(Layer* layer) { m_Dependencies.push_back(layer); m_DependencyVersion++; }
+		void RemoveDependency(Layer* layer);
+		const std::vector<Layer*>& GetDependencies() const { return m_Dependencies; }
+		// Bumped on every change to the dependencies, so the layer stack knows to rebuild its graph
+		uint32_t GetDependencyVersion() const { return m_DependencyVersion; }
+
+		bool HasParallelUpdate() const { return m_HasParallelUpdate; }
 	protected:
 		std::string m_DebugName;
+		std::vector<Layer*> m_Dependencies;
+	private:
+		uint32_t m_DependencyVersion = 0;
+		bool m_HasParallelUpdate = true;
 	};
 
 }
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include "hzpch.h"
 #include "Hazel/Core/LayerStack.h"
 
+#include "Hazel/Core/JobSystem.h"
+
+#include <limits>
+
 namespace Hazel {
 
 	LayerStack::~LayerStack()
@@ -16,11 +20,13 @@ namespace Hazel {
 	{
 		m_Layers.emplace(m_Layers.begin() + m_LayerInsertIndex, layer);
 		m_LayerInsertIndex++;
+		m_ParallelGraphDirty = true;
 	}
 
 	void LayerStack::PushOverlay(Layer* overlay)
 	{
 		m_Layers.emplace_back(overlay);
+		m_ParallelGraphDirty = true;
 	}
 
 	void LayerStack::PopLayer(Layer* layer)
@@ -31,6 +37,7 @@ namespace Hazel {
 			layer->OnDetach();
 			m_Layers.erase(it);
 			m_LayerInsertIndex--;
+			RemoveFromDependencies(layer);
 		}
 	}
 
@@ -41,6 +48,156 @@ namespace Hazel {
 		{
 			overlay->OnDetach();
 			m_Layers.erase(it);
+			RemoveFromDependencies(overlay);
+		}
+	}
+
+	void LayerStack::RemoveFromDependencies(Layer* layer)
+	{
+		// A layer pushed later could reuse the address, and must not inherit the dependency
+		for (Layer* other : m_Layers)
+			other->RemoveDependency(layer);
+
+		m_ParallelGraphDirty = true;
+	}
+
+	void LayerStack::BuildParallelGraph()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		static constexpr uint32_t Skipped = std::numeric_limits<uint32_t>::max();
+
+		ParallelGraph& graph = m_ParallelGraph;
+		graph.Layers.clear();
+		for (Layer* layer : m_Layers)
+		{
+			if (layer->HasParallelUpdate())
+				graph.Layers.push_back(layer);
+		}
+
+		uint32_t layerCount = (uint32_t)graph.Layers.size();
+
+		std::unordered_map<Layer*, uint32_t> indices;
+		for (Layer* layer : m_Layers)
+			indices[layer] = Skipped;
+		for (uint32_t i = 0; i < layerCount; i++)
+			indices[graph.Layers[i]] = i;
+
+		graph.Dependents.assign(layerCount, {});
+		graph.DependencyCounts.assign(layerCount, 0);
+		for (uint32_t i = 0; i < layerCount; i++)
+		{
+			// Depending on a skipped layer means depending on what it depends on
+			std::unordered_set<Layer*> visited;
+			std::vector<Layer*> pending = graph.Layers[i]->GetDependencies();
+			while (!pending.empty())
+			{
+				Layer* dependency = pending.back();
+				pending.pop_back();
+
+				auto it = indices.find(dependency);
+				if (it == indices.end() || it->second == i || !visited.insert(dependency).second)
+					continue;
+
+				if (it->second == Skipped)
+				{
+					const auto& next = dependency->GetDependencies();
+					pending.insert(pending.end(), next.begin(), next.end());
+					continue;
+				}
+
+				graph.Dependents[it->second].push_back(i);
+				graph.DependencyCounts[i]++;
+			}
+		}
+
+		graph.Roots.clear();
+		for (uint32_t i = 0; i < layerCount; i++)
+		{
+			if (graph.DependencyCounts[i] == 0)
+				graph.Roots.push_back(i);
+		}
+
+		// A cycle would never start; ParallelUpdate falls back to stack order rather than hang
+		std::vector<uint32_t> unresolved = graph.DependencyCounts;
+		std::vector<uint32_t> ready = graph.Roots;
+		for (size_t next = 0; next < ready.size(); next++)
+		{
+			for (uint32_t dependent : graph.Dependents[ready[next]])
+			{
+				if (--unresolved[dependent] == 0)
+					ready.push_back(dependent);
+			}
+		}
+		graph.HasCycle = ready.size() != layerCount;
+		if (graph.HasCycle)
+			HZ_CORE_ERROR("Layer dependencies form a cycle, updating layers in stack order");
+
+		graph.Remaining = std::make_unique<std::atomic<uint32_t>[]>(layerCount);
+		m_ParallelGraphDirty = false;
+	}
+
+	void LayerStack::LaunchParallelUpdate(uint32_t index, Timestep ts, JobCounter& counter)
+	{
+		JobSystem::Run([this, index, ts, &counter]()
+		{
+			Layer* layer = m_ParallelGraph.Layers[index];
+			{
+				HZ_PROFILE_SCOPE(layer->GetName().c_str());
+				layer->OnParallelUpdate(ts);
+			}
+
+			// Started before this job finishes, so the counter cannot reach zero early
+			for (uint32_t dependent : m_ParallelGraph.Dependents[index])
+			{
+				if (m_ParallelGraph.Remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1)
+					LaunchParallelUpdate(dependent, ts, counter);
+			}
+		}, &counter);
+	}
+
+	void LayerStack::ParallelUpdate(Timestep ts)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		uint32_t dependencyVersion = 0;
+		for (Layer* layer : m_Layers)
+			dependencyVersion += layer->GetDependencyVersion();
+		if (dependencyVersion != m_DependencyVersion)
+		{
+			m_DependencyVersion = dependencyVersion;
+			m_ParallelGraphDirty = true;
+		}
+
+		if (m_ParallelGraphDirty)
+			BuildParallelGraph();
+
+		ParallelGraph& graph = m_ParallelGraph;
+		if (graph.HasCycle)
+		{
+			for (Layer* layer : graph.Layers)
+				layer->OnParallelUpdate(ts);
+		}
+		else if (!graph.Layers.empty())
+		{
+			for (uint32_t i = 0; i < (uint32_t)graph.Layers.size(); i++)
+				graph.Remaining[i].store(graph.DependencyCounts[i], std::memory_order_relaxed);
+
+			JobCounter counter;
+			for (uint32_t root : graph.Roots)
+				LaunchParallelUpdate(root, ts, counter);
+
+			JobSystem::Wait(counter);
+		}
+
+		// Layers that ran the default hook drop out from the next frame on
+		for (Layer* layer : graph.Layers)
+		{
+			if (!layer->HasParallelUpdate())
+			{
+				m_ParallelGraphDirty = true;
+				break;
+			}
 		}
 	}
 
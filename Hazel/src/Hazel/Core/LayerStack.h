@@ -3,10 +3,14 @@
 #include "Hazel/Core/Core.h"
 #include "Hazel/Core/Layer.h"
 
+#include <atomic>
+#include <memory>
 #include <vector>
 
 namespace Hazel {
 
+	class JobCounter;
+
 	class LayerStack
 	{
 	public:
@@ -18,6 +22,11 @@ namespace Hazel {
 		void PopLayer(Layer* layer);
 		void PopOverlay(Layer* overlay);
 
+		// Runs every layer's OnParallelUpdate on the job system, each as soon as the
+		// layers it depends on are done, and returns once all have finished. The graph is
+		// only rebuilt when layers or their dependencies change.
+		void ParallelUpdate(Timestep ts);
+
 		std::vector<Layer*>::iterator begin() { return m_Layers.begin(); }
 		std::vector<Layer*>::iterator end() { return m_Layers.end(); }
 		std::vector<Layer*>::reverse_iterator rbegin() { return m_Layers.rbegin(); }
@@ -27,9 +36,29 @@ namespace Hazel {
 		std::vector<Layer*>::const_iterator end()	const { return m_Layers.end(); }
 		std::vector<Layer*>::const_reverse_iterator rbegin() const { return m_Layers.rbegin(); }
 		std::vector<Layer*>::const_reverse_iterator rend() const { return m_Layers.rend(); }
+	private:
+		void RemoveFromDependencies(Layer* layer);
+		void BuildParallelGraph();
+		void LaunchParallelUpdate(uint32_t index, Timestep ts, JobCounter& counter);
 	private:
 		std::vector<Layer*> m_Layers;
 		unsigned int m_LayerInsertIndex = 0;
+
+		// Only the layers that override OnParallelUpdate, with dependencies on skipped
+		// layers resolved to whatever those depend on
+		struct ParallelGraph
+		{
+			std::vector<Layer*> Layers;
+			// Edges point from a layer to the layers waiting for it
+			std::vector<std::vector<uint32_t>> Dependents;
+			std::vector<uint32_t> DependencyCounts;
+			std::unique_ptr<std::atomic<uint32_t>[]> Remaining;
+			std::vector<uint32_t> Roots;
+			bool HasCycle = false;
+		};
+		ParallelGraph m_ParallelGraph;
+		bool m_ParallelGraphDirty = true;
+		uint32_t m_DependencyVersion = 0;
 	};
 
 }
\ No newline at end of file
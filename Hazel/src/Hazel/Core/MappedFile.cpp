@@ -0,0 +1,28 @@
+#include "hzpch.h"
+#include "Hazel/Core/MappedFile.h"
+
+#ifdef HZ_PLATFORM_WINDOWS
+	#include "Platform/Windows/WindowsMappedFile.h"
+#elif defined(HZ_PLATFORM_LINUX)
+	#include "Platform/Linux/LinuxMappedFile.h"
+#endif
+
+namespace Hazel {
+
+	Scope<MappedFile> MappedFile::Open(const std::string& filepath)
+	{
+	#ifdef HZ_PLATFORM_WINDOWS
+		auto file = CreateScope<WindowsMappedFile>(filepath);
+	#elif defined(HZ_PLATFORM_LINUX)
+		auto file = CreateScope<LinuxMappedFile>(filepath);
+	#else
+		HZ_CORE_ASSERT(false, "Unknown platform!");
+		return nullptr;
+	#endif
+
+		if (!file->GetData())
+			return nullptr;
+		return file;
+	}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <string>
+
+namespace Hazel {
+
+	// Read-only view of a whole file through the OS page cache. Pages are faulted in
+	// on first access, so opening is cheap and nothing is copied into the process.
+	class MappedFile
+	{
+	public:
+		virtual ~MappedFile() = default;
+
+		virtual const uint8_t* GetData() const = 0;
+		virtual uint64_t GetSize() const = 0;
+
+		// Returns nullptr if the file cannot be opened or is empty
+		static Scope<MappedFile> Open(const std::string& filepath);
+	};
+
+}
@@ -0,0 +1,47 @@
+#include "hzpch.h"
+#include "Hazel/Core/PollingFileWatcher.h"
+
+namespace Hazel {
+
+	static std::filesystem::file_time_type GetWriteTime(const std::string& filepath)
+	{
+		std::error_code error;
+		auto time = std::filesystem::last_write_time(filepath, error);
+		return error ? std::filesystem::file_time_type::min() : time;
+	}
+
+	void PollingFileWatcher::Watch(const std::string& filepath)
+	{
+		m_Files[filepath] = GetWriteTime(filepath);
+	}
+
+	void PollingFileWatcher::Unwatch(const std::string& filepath)
+	{
+		m_Files.erase(filepath);
+	}
+
+	std::vector<std::string> PollingFileWatcher::Poll()
+	{
+		std::vector<std::string> changed;
+
+		auto now = std::chrono::steady_clock::now();
+		if (now - m_LastPoll < PollInterval)
+			return changed;
+		m_LastPoll = now;
+
+		HZ_PROFILE_FUNCTION();
+
+		for (auto& [filepath, lastWriteTime] : m_Files)
+		{
+			// Editors that save through a temporary file briefly remove the original;
+			// that shows up as min() and is picked up once the file is back
+			auto writeTime = GetWriteTime(filepath);
+			if (writeTime != lastWriteTime && writeTime != std::filesystem::file_time_type::min())
+				changed.push_back(filepath);
+			lastWriteTime = writeTime;
+		}
+
+		return changed;
+	}
+
+}
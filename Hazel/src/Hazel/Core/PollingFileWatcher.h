@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Hazel/Core/FileWatcher.h"
+
+#include <chrono>
+#include <filesystem>
+
+namespace Hazel {
+
+	// Portable fallback for platforms without a native change notification backend:
+	// compares modification times, at most every PollInterval
+	class PollingFileWatcher : public FileWatcher
+	{
+	public:
+		virtual void Watch(const std::string& filepath) override;
+		virtual void Unwatch(const std::string& filepath) override;
+
+		virtual std::vector<std::string> Poll() override;
+	private:
+		static constexpr std::chrono::milliseconds PollInterval{ 250 };
+
+		std::unordered_map<std::string, std::filesystem::file_time_type> m_Files;
+		std::chrono::steady_clock::time_point m_LastPoll;
+	};
+
+}
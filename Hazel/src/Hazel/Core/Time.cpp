@@ -0,0 +1,13 @@
+#include "hzpch.h"
+#include "Hazel/Core/Time.h"
+
+#include <chrono>
+
+namespace Hazel {
+
+	uint64_t Time::GetNanoseconds()
+	{
+		return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+	}
+
+}
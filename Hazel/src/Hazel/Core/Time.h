@@ -0,0 +1,14 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace Hazel {
+
+	class Time
+	{
+	public:
+		// Monotonic clock in nanoseconds since an arbitrary point; only differences are meaningful
+		static uint64_t GetNanoseconds();
+	};
+
+}
@@ -7,6 +7,8 @@
 
 namespace Hazel {
 
+	class GraphicsContext;
+
 	struct WindowProps
 	{
 		std::string Title;
@@ -40,6 +42,7 @@ namespace Hazel {
 		virtual bool IsVSync() const = 0;
 
 		virtual void* GetNativeWindow() const = 0;
+		virtual GraphicsContext& GetContext() = 0;
 
 		static Scope<Window> Create(const WindowProps& props = WindowProps());
 	};
@@ -20,6 +20,19 @@ namespace Hazel {
 		std::thread::id ThreadID;
 	};
 
+	// One series of a counter event; accepts any arithmetic value
+	struct ProfileCounterValue
+	{
+		const char* Name;
+		double Value;
+
+		template<typename T>
+		ProfileCounterValue(const char* name, T value)
+			: Name(name), Value((double)value)
+		{
+		}
+	};
+
 	struct InstrumentationSession
 	{
 		std::string Name;
@@ -31,6 +44,8 @@ namespace Hazel {
 		std::mutex m_Mutex;
 		InstrumentationSession* m_CurrentSession;
 		std::ofstream m_OutputStream;
+		// Written at the start of every session, so threads named earlier keep their names
+		std::vector<std::pair<std::thread::id, std::string>> m_ThreadNames;
 	public:
 		Instrumentor()
 			: m_CurrentSession(nullptr)
@@ -93,6 +108,53 @@ namespace Hazel {
 			}
 		}
 
+		// Counter events show up as a graph track named after the counter, one series per value
+		void WriteCounter(const char* counterName, std::initializer_list<ProfileCounterValue> values)
+		{
+			std::stringstream json;
+
+			std::string name = counterName;
+			std::replace(name.begin(), name.end(), '"', '\'');
+
+			auto timestamp = FloatingPointMicroseconds{ std::chrono::steady_clock::now().time_since_epoch() };
+
+			json << std::setprecision(3) << std::fixed;
+			json << ",{";
+			json << "\"cat\":\"counter\",";
+			json << "\"name\":\"" << name << "\",";
+			json << "\"ph\":\"C\",";
+			json << "\"pid\":0,";
+			json << "\"tid\":" << std::this_thread::get_id() << ",";
+			json << "\"ts\":" << timestamp.count() << ",";
+			json << "\"args\":{";
+			bool first = true;
+			for (const auto& value : values)
+			{
+				if (!first)
+					json << ',';
+				json << "\"" << value.Name << "\":" << value.Value;
+				first = false;
+			}
+			json << "}}";
+
+			std::lock_guard lock(m_Mutex);
+			if (m_CurrentSession) {
+				m_OutputStream << json.str();
+				m_OutputStream.flush();
+			}
+		}
+
+		// Labels the calling thread's track in the trace viewer
+		void SetThreadName(const std::string& threadName)
+		{
+			std::lock_guard lock(m_Mutex);
+			m_ThreadNames.emplace_back(std::this_thread::get_id(), threadName);
+			if (m_CurrentSession) {
+				WriteThreadName(m_ThreadNames.back().first, threadName);
+				m_OutputStream.flush();
+			}
+		}
+
 		static Instrumentor& Get() {
 			static Instrumentor instance;
 			return instance;
@@ -103,9 +165,25 @@ namespace Hazel {
 		void WriteHeader()
 		{
 			m_OutputStream << "{\"otherData\": {},\"traceEvents\":[{}";
+			for (const auto& [threadID, threadName] : m_ThreadNames)
+				WriteThreadName(threadID, threadName);
 			m_OutputStream.flush();
 		}
 
+		void WriteThreadName(std::thread::id threadID, const std::string& threadName)
+		{
+			std::string name = threadName;
+			std::replace(name.begin(), name.end(), '"', '\'');
+
+			m_OutputStream << ",{";
+			m_OutputStream << "\"name\":\"thread_name\",";
+			m_OutputStream << "\"ph\":\"M\",";
+			m_OutputStream << "\"pid\":0,";
+			m_OutputStream << "\"tid\":" << threadID << ",";
+			m_OutputStream << "\"args\":{\"name\":\"" << name << "\"}";
+			m_OutputStream << "}";
+		}
+
 		void WriteFooter()
 		{
 			m_OutputStream << "]}";
@@ -184,9 +262,13 @@ namespace Hazel {
 	#define HZ_PROFILE_END_SESSION() ::Hazel::Instrumentor::Get().EndSession()
 	#define HZ_PROFILE_SCOPE(name) ::Hazel::InstrumentationTimer timer##__LINE__(name);
 	#define HZ_PROFILE_FUNCTION() HZ_PROFILE_SCOPE(HZ_FUNC_SIG)
+	#define HZ_PROFILE_COUNTER(name, ...) ::Hazel::Instrumentor::Get().WriteCounter(name, __VA_ARGS__)
+	#define HZ_PROFILE_THREAD(name) ::Hazel::Instrumentor::Get().SetThreadName(name)
 #else
 	#define HZ_PROFILE_BEGIN_SESSION(name, filepath)
 	#define HZ_PROFILE_END_SESSION()
 	#define HZ_PROFILE_SCOPE(name)
 	#define HZ_PROFILE_FUNCTION()
+	#define HZ_PROFILE_COUNTER(name, ...)
+	#define HZ_PROFILE_THREAD(name)
 #endif
\ No newline at end of file
@@ -6,6 +6,9 @@
 #include <examples/imgui_impl_opengl3.h>
 
 #include "Hazel/Core/Application.h"
+#include "Hazel/Renderer/RenderThread.h"
+
+#include "Platform/OpenGL/OpenGLStateCache.h"
 
 // TEMPORARY
 #include <GLFW/glfw3.h>
@@ -13,6 +16,28 @@
 
 namespace Hazel {
 
+	// A frame's draw data for the render thread, which may still be drawing it while
+	// the next NewFrame rebuilds ImGui's own draw lists
+	struct ImGuiDrawDataCopy
+	{
+		ImDrawData Data;
+		std::vector<ImDrawList*> Lists;
+
+		ImGuiDrawDataCopy(const ImDrawData& source)
+			: Data(source)
+		{
+			for (int i = 0; i < source.CmdListsCount; i++)
+				Lists.push_back(source.CmdLists[i]->CloneOutput());
+			Data.CmdLists = Lists.data();
+		}
+
+		~ImGuiDrawDataCopy()
+		{
+			for (ImDrawList* list : Lists)
+				IM_DELETE(list);
+		}
+	};
+
 	ImGuiLayer::ImGuiLayer()
 		: Layer("ImGuiLayer")
 	{
@@ -66,7 +91,19 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		ImGui_ImplOpenGL3_NewFrame();
+		ImGuiIO& io = ImGui::GetIO();
+		if (RenderThread::IsRecording())
+		{
+			// Platform windows would need the context on this thread
+			io.ConfigFlags &= ~ImGuiConfigFlags_ViewportsEnable;
+		}
+
+		// The first backend NewFrame builds the font atlas ImGui::NewFrame expects, so it cannot be deferred
+		if (io.Fonts->IsBuilt())
+			RenderThread::Submit([]() { ImGui_ImplOpenGL3_NewFrame(); });
+		else
+			RenderThread::ExecuteSync([]() { ImGui_ImplOpenGL3_NewFrame(); });
+
 		ImGui_ImplGlfw_NewFrame();
 		ImGui::NewFrame();
 	}
@@ -81,6 +118,17 @@ namespace Hazel {
 
 		// Rendering
 		ImGui::Render();
+
+		if (RenderThread::IsRecording())
+		{
+			RenderThread::Submit([drawData = CreateRef<ImGuiDrawDataCopy>(*ImGui::GetDrawData())]()
+			{
+				ImGui_ImplOpenGL3_RenderDrawData(&drawData->Data);
+				OpenGLStateCache::Invalidate();
+			});
+			return;
+		}
+
 		ImGui_ImplOpenGL3_RenderDrawData(ImGui::GetDrawData());
 
 		if (io.ConfigFlags & ImGuiConfigFlags_ViewportsEnable)
@@ -90,6 +138,9 @@ namespace Hazel {
 			ImGui::RenderPlatformWindowsDefault();
 			glfwMakeContextCurrent(backup_current_context);
 		}
+
+		// The ImGui backend binds GL state behind our back
+		OpenGLStateCache::Invalidate();
 	}
 
 }
\ No newline at end of file
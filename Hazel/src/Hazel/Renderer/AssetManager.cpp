@@ -0,0 +1,295 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/AssetManager.h"
+
+#include <filesystem>
+#include <fstream>
+
+namespace Hazel {
+
+	static constexpr uint32_t AssetIndexBits = 20;
+	static constexpr uint32_t AssetIndexMask = (1u << AssetIndexBits) - 1;
+	static constexpr uint32_t AssetGenerationMask = (1u << (32 - AssetIndexBits)) - 1;
+
+	struct AssetSlot
+	{
+		std::string Path;
+		AssetType Type = AssetType::None;
+		// Held while RefCount > 0; Cached outlives it for as long as someone keeps a Ref
+		std::shared_ptr<void> Asset;
+		std::weak_ptr<void> Cached;
+		uint32_t RefCount = 0;
+		// Starts at 1 so no valid handle is ever 0
+		uint32_t Generation = 1;
+	};
+
+	struct AssetManagerData
+	{
+		std::vector<AssetSlot> Slots;
+		std::vector<uint32_t> FreeSlots;
+		std::unordered_map<std::string, uint32_t> PathToSlot;
+	};
+
+	static AssetManagerData* s_Data = nullptr;
+
+	static AssetHandle MakeHandle(uint32_t index, uint32_t generation)
+	{
+		return (generation << AssetIndexBits) | index;
+	}
+
+	static AssetSlot* GetSlot(AssetHandle handle)
+	{
+		uint32_t index = handle & AssetIndexMask;
+		if (!s_Data || handle == InvalidAssetHandle || index >= s_Data->Slots.size())
+			return nullptr;
+
+		AssetSlot& slot = s_Data->Slots[index];
+		if (slot.Type == AssetType::None || slot.Generation != handle >> AssetIndexBits)
+			return nullptr;
+
+		return &slot;
+	}
+
+	static std::string NormalizePath(const std::string& path)
+	{
+		return std::filesystem::path(path).lexically_normal().generic_string();
+	}
+
+	static void FreeSlot(uint32_t index)
+	{
+		AssetSlot& slot = s_Data->Slots[index];
+		s_Data->PathToSlot.erase(slot.Path);
+
+		slot.Path.clear();
+		slot.Type = AssetType::None;
+		slot.Asset.reset();
+		slot.Cached.reset();
+		// Invalidates every handle still pointing at this slot
+		slot.Generation = (slot.Generation + 1) & AssetGenerationMask;
+		if (slot.Generation == 0)
+			slot.Generation = 1;
+
+		s_Data->FreeSlots.push_back(index);
+	}
+
+	// Released assets nobody else holds on to any more
+	static void CollectReleased()
+	{
+		for (uint32_t index = 0; index < s_Data->Slots.size(); index++)
+		{
+			AssetSlot& slot = s_Data->Slots[index];
+			if (slot.Type != AssetType::None && slot.RefCount == 0 && slot.Cached.expired())
+				FreeSlot(index);
+		}
+	}
+
+	static std::shared_ptr<void> CreateAsset(AssetType type, const std::string& path)
+	{
+		switch (type)
+		{
+			case AssetType::Texture2D: return Texture2D::CreateAsync(path);
+			case AssetType::Shader:    return Shader::CreateAsync(path);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown asset type!");
+		return nullptr;
+	}
+
+	static AssetHandle LoadAsset(AssetType type, const std::string& path)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(s_Data, "AssetManager is not initialized!");
+
+		std::string key = NormalizePath(path);
+		auto existing = s_Data->PathToSlot.find(key);
+		if (existing != s_Data->PathToSlot.end())
+		{
+			uint32_t index = existing->second;
+			AssetSlot& slot = s_Data->Slots[index];
+			if (slot.Type != type)
+			{
+				HZ_CORE_ERROR("Asset '{0}' was already loaded as a different type!", key);
+				return InvalidAssetHandle;
+			}
+
+			if (!slot.Asset)
+			{
+				slot.Asset = slot.Cached.lock();
+				if (!slot.Asset)
+				{
+					slot.Asset = CreateAsset(type, key);
+					slot.Cached = slot.Asset;
+				}
+			}
+
+			slot.RefCount++;
+			return MakeHandle(index, slot.Generation);
+		}
+
+		if (s_Data->FreeSlots.empty())
+			CollectReleased();
+
+		uint32_t index;
+		if (!s_Data->FreeSlots.empty())
+		{
+			index = s_Data->FreeSlots.back();
+			s_Data->FreeSlots.pop_back();
+		}
+		else
+		{
+			HZ_CORE_ASSERT(s_Data->Slots.size() <= AssetIndexMask, "Too many assets!");
+			index = (uint32_t)s_Data->Slots.size();
+			s_Data->Slots.emplace_back();
+		}
+
+		AssetSlot& slot = s_Data->Slots[index];
+		slot.Path = key;
+		slot.Type = type;
+		slot.Asset = CreateAsset(type, key);
+		slot.Cached = slot.Asset;
+		slot.RefCount = 1;
+
+		s_Data->PathToSlot[key] = index;
+		return MakeHandle(index, slot.Generation);
+	}
+
+	void AssetManager::Init()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		s_Data = new AssetManagerData();
+	}
+
+	void AssetManager::Shutdown()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	AssetHandle AssetManager::LoadTexture(const std::string& path)
+	{
+		return LoadAsset(AssetType::Texture2D, path);
+	}
+
+	AssetHandle AssetManager::LoadShader(const std::string& path)
+	{
+		return LoadAsset(AssetType::Shader, path);
+	}
+
+	AssetHandle AssetManager::Load(const std::string& path)
+	{
+		std::string extension = std::filesystem::path(path).extension().string();
+		std::transform(extension.begin(), extension.end(), extension.begin(), [](char c) { return (char)std::tolower(c); });
+
+		return LoadAsset(extension == ".glsl" ? AssetType::Shader : AssetType::Texture2D, path);
+	}
+
+	std::vector<AssetHandle> AssetManager::Preload(const std::vector<std::string>& paths)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::vector<AssetHandle> handles;
+		handles.reserve(paths.size());
+		for (const auto& path : paths)
+			handles.push_back(Load(path));
+
+		return handles;
+	}
+
+	std::vector<AssetHandle> AssetManager::PreloadList(const std::string& listPath)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::ifstream in(listPath);
+		if (!in)
+		{
+			HZ_CORE_ERROR("Could not open preload list '{0}'", listPath);
+			return {};
+		}
+
+		std::vector<std::string> paths;
+		std::string line;
+		while (std::getline(in, line))
+		{
+			size_t begin = line.find_first_not_of(" \t\r");
+			if (begin == std::string::npos || line[begin] == '#')
+				continue;
+
+			size_t end = line.find_last_not_of(" \t\r");
+			paths.push_back(line.substr(begin, end - begin + 1));
+		}
+
+		return Preload(paths);
+	}
+
+	void AssetManager::Release(AssetHandle handle)
+	{
+		// Layers are detached after the renderer shut down, and everything is gone by then
+		if (!s_Data)
+			return;
+
+		AssetSlot* slot = GetSlot(handle);
+		HZ_CORE_ASSERT(slot && slot->RefCount > 0, "Releasing an invalid asset handle!");
+		if (!slot || slot->RefCount == 0)
+			return;
+
+		if (--slot->RefCount > 0)
+			return;
+
+		slot->Asset.reset();
+		if (slot->Cached.expired())
+			FreeSlot(handle & AssetIndexMask);
+	}
+
+	bool AssetManager::IsValid(AssetHandle handle)
+	{
+		AssetSlot* slot = GetSlot(handle);
+		return slot && slot->RefCount > 0;
+	}
+
+	AssetType AssetManager::GetType(AssetHandle handle)
+	{
+		AssetSlot* slot = GetSlot(handle);
+		return slot ? slot->Type : AssetType::None;
+	}
+
+	const std::string& AssetManager::GetPath(AssetHandle handle)
+	{
+		static const std::string s_Empty;
+
+		AssetSlot* slot = GetSlot(handle);
+		return slot ? slot->Path : s_Empty;
+	}
+
+	Texture2D* AssetManager::GetTexture(AssetHandle handle)
+	{
+		AssetSlot* slot = GetSlot(handle);
+		return slot && slot->Type == AssetType::Texture2D ? (Texture2D*)slot->Asset.get() : nullptr;
+	}
+
+	Shader* AssetManager::GetShader(AssetHandle handle)
+	{
+		AssetSlot* slot = GetSlot(handle);
+		return slot && slot->Type == AssetType::Shader ? (Shader*)slot->Asset.get() : nullptr;
+	}
+
+	Ref<Texture2D> AssetManager::GetTextureRef(AssetHandle handle)
+	{
+		AssetSlot* slot = GetSlot(handle);
+		return slot && slot->Type == AssetType::Texture2D ? std::static_pointer_cast<Texture2D>(slot->Asset) : nullptr;
+	}
+
+	Ref<Shader> AssetManager::GetShaderRef(AssetHandle handle)
+	{
+		AssetSlot* slot = GetSlot(handle);
+		return slot && slot->Type == AssetType::Shader ? std::static_pointer_cast<Shader>(slot->Asset) : nullptr;
+	}
+
+	uint32_t AssetManager::GetAssetCount()
+	{
+		return s_Data ? (uint32_t)(s_Data->PathToSlot.size()) : 0;
+	}
+
+}
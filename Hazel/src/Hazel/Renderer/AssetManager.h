@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel {
+
+	// Refers to an asset loaded through the AssetManager. The low bits index a slot and
+	// the high bits count how often that slot was reused, so a handle that outlived its
+	// asset resolves to nothing instead of to whatever took its place.
+	using AssetHandle = uint32_t;
+	static constexpr AssetHandle InvalidAssetHandle = 0;
+
+	enum class AssetType : uint8_t
+	{
+		None = 0, Texture2D, Shader
+	};
+
+	// Loads textures and shaders once per path. Every Load of a path returns the same
+	// handle and takes a reference that Release gives back; the asset is freed once the
+	// last reference is released and no Ref obtained from GetTextureRef/GetShaderRef is
+	// left. Until then it stays cached and loading the path again is free.
+	// Textures load asynchronously and shaders compile in the background.
+	// Main thread only.
+	class AssetManager
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		static AssetHandle LoadTexture(const std::string& path);
+		static AssetHandle LoadShader(const std::string& path);
+		// Picks the asset type from the extension: .glsl is a shader, anything else a texture
+		static AssetHandle Load(const std::string& path);
+
+		// Starts loading all of them at once, so decodes and compiles overlap
+		static std::vector<AssetHandle> Preload(const std::vector<std::string>& paths);
+		// Text file with one asset path per line; empty lines and lines starting with # are skipped
+		static std::vector<AssetHandle> PreloadList(const std::string& listPath);
+
+		static void Release(AssetHandle handle);
+
+		static bool IsValid(AssetHandle handle);
+		static AssetType GetType(AssetHandle handle);
+		static const std::string& GetPath(AssetHandle handle);
+
+		// Borrowed pointers, valid while the handle holds a reference. Null for stale
+		// handles or handles of another type.
+		static Texture2D* GetTexture(AssetHandle handle);
+		static Shader* GetShader(AssetHandle handle);
+
+		static Ref<Texture2D> GetTextureRef(AssetHandle handle);
+		static Ref<Shader> GetShaderRef(AssetHandle handle);
+
+		// Live slots, including released assets that are still cached
+		static uint32_t GetAssetCount();
+	};
+
+}
@@ -35,11 +35,13 @@ namespace Hazel {
 		uint32_t Size;
 		size_t Offset;
 		bool Normalized;
+		// Number of instances drawn before the attribute advances; 0 advances per vertex
+		uint32_t Divisor;
 
 		BufferElement() = default;
 
-		BufferElement(ShaderDataType type, const std::string& name, bool normalized = false)
-			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized)
+		BufferElement(ShaderDataType type, const std::string& name, bool normalized = false, uint32_t divisor = 0)
+			: Name(name), Type(type), Size(ShaderDataTypeSize(type)), Offset(0), Normalized(normalized), Divisor(divisor)
 		{
 		}
 
@@ -100,6 +102,17 @@ namespace Hazel {
 		uint32_t m_Stride = 0;
 	};
 
+	enum class VertexBufferUsage
+	{
+		// Uploaded once, drawn many times
+		Static = 0,
+		// Updated in place with SetData now and then
+		Dynamic,
+		// Fully rewritten every time it is drawn (sprites, particles); each SetData in a frame
+		// lands after the previous one in a fenced ring, so draws must source from GetDrawOffset()
+		Stream
+	};
+
 	class VertexBuffer
 	{
 	public:
@@ -108,9 +121,15 @@ namespace Hazel {
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
+		// Stream buffers never overwrite earlier data of the frame, so offset must be 0 for them
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+		// Byte offset the contents of the last SetData start at; always 0 unless streaming
+		virtual uint32_t GetDrawOffset() const = 0;
+
 		virtual const BufferLayout& GetLayout() const = 0;
 		virtual void SetLayout(const BufferLayout& layout) = 0;
 
+		static Ref<VertexBuffer> Create(uint32_t size, VertexBufferUsage usage = VertexBufferUsage::Dynamic);
 		static Ref<VertexBuffer> Create(float* vertices, uint32_t size);
 	};
 
@@ -124,7 +143,7 @@ namespace Hazel {
 
 		virtual uint32_t GetCount() const = 0;
 
-		static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t size);
+		static Ref<IndexBuffer> Create(uint32_t* indices, uint32_t count);
 	};
 
 }
\ No newline at end of file
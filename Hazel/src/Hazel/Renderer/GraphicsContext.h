@@ -8,6 +8,10 @@ namespace Hazel {
 		virtual void Init() = 0;
 		virtual void SwapBuffers() = 0;
 
+		// Binds the context to the calling thread, or unbinds it so another thread can take it
+		virtual void MakeCurrent() = 0;
+		virtual void ReleaseCurrent() = 0;
+
 		static Scope<GraphicsContext> Create(void* window);
 	};
 
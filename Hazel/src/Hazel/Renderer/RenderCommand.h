@@ -1,9 +1,11 @@
 #pragma once
 
 #include "Hazel/Renderer/RendererAPI.h"
+#include "Hazel/Renderer/RenderThread.h"
 
 namespace Hazel {
 
+	// Calls go through RenderThread::Submit, so they are recorded while a render thread runs
 	class RenderCommand
 	{
 	public:
@@ -14,22 +16,50 @@ namespace Hazel {
 
 		inline static void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
 		{
-			s_RendererAPI->SetViewport(x, y, width, height);
+			RenderThread::Submit([=]() { s_RendererAPI->SetViewport(x, y, width, height); });
 		}
 
 		inline static void SetClearColor(const glm::vec4& color)
 		{
-			s_RendererAPI->SetClearColor(color);
+			RenderThread::Submit([color]() { s_RendererAPI->SetClearColor(color); });
 		}
 
 		inline static void Clear()
 		{
-			s_RendererAPI->Clear();
+			RenderThread::Submit([]() { s_RendererAPI->Clear(); });
 		}
 
-		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray)
+		inline static void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0)
 		{
-			s_RendererAPI->DrawIndexed(vertexArray);
+			RenderThread::Submit([vertexArray, indexCount, baseVertex]() { s_RendererAPI->DrawIndexed(vertexArray, indexCount, baseVertex); });
+		}
+
+		inline static void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0)
+		{
+			RenderThread::Submit([=]() { s_RendererAPI->DrawIndexedInstanced(vertexArray, indexCount, instanceCount, baseInstance); });
+		}
+
+		inline static uint32_t GetMaxTextureSlots()
+		{
+			uint32_t slots = 0;
+			RenderThread::ExecuteSync([&]() { slots = s_RendererAPI->GetMaxTextureSlots(); });
+			return slots;
+		}
+
+		inline static void EndFrame()
+		{
+			RenderThread::Submit([]() { s_RendererAPI->EndFrame(); });
+		}
+
+		// Live counts for the thread executing commands; see Renderer::GetStateStatistics
+		inline static RendererAPI::StateStatistics GetStateStatistics()
+		{
+			return s_RendererAPI->GetStateStatistics();
+		}
+
+		inline static void ResetStateStatistics()
+		{
+			RenderThread::Submit([]() { s_RendererAPI->ResetStateStatistics(); });
 		}
 	private:
 		static Scope<RendererAPI> s_RendererAPI;
@@ -0,0 +1,66 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/RenderCommandQueue.h"
+
+namespace Hazel {
+
+	static uint32_t AlignUp(uint32_t size, uint32_t alignment)
+	{
+		return (size + alignment - 1) & ~(alignment - 1);
+	}
+
+	RenderCommandQueue::~RenderCommandQueue()
+	{
+		HZ_CORE_ASSERT(m_CommandCount == 0, "Render commands were recorded but never executed!");
+
+		for (auto& block : m_Blocks)
+			::operator delete(block.Data, std::align_val_t(Alignment));
+	}
+
+	void* RenderCommandQueue::Allocate(uint32_t size, ExecuteFn execute)
+	{
+		uint32_t headerSize = AlignUp(sizeof(CommandHeader), Alignment);
+		uint32_t totalSize = headerSize + AlignUp(size, Alignment);
+
+		// Move on to the next block with room; one that is too small for any block gets its own
+		while (m_CurrentBlock < m_Blocks.size() && m_Blocks[m_CurrentBlock].Used + totalSize > m_Blocks[m_CurrentBlock].Capacity)
+			m_CurrentBlock++;
+
+		if (m_CurrentBlock == m_Blocks.size())
+		{
+			uint32_t capacity = std::max(BlockSize, totalSize);
+			m_Blocks.push_back({ (uint8_t*)::operator new(capacity, std::align_val_t(Alignment)), capacity, 0 });
+		}
+
+		Block& block = m_Blocks[m_CurrentBlock];
+		uint8_t* header = block.Data + block.Used;
+		block.Used += totalSize;
+
+		new (header) CommandHeader{ execute, totalSize };
+		if (execute)
+			m_CommandCount++;
+
+		return header + headerSize;
+	}
+
+	void RenderCommandQueue::Execute()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		uint32_t headerSize = AlignUp(sizeof(CommandHeader), Alignment);
+		for (auto& block : m_Blocks)
+		{
+			for (uint32_t offset = 0; offset < block.Used; )
+			{
+				CommandHeader& header = *(CommandHeader*)(block.Data + offset);
+				if (header.Execute)
+					header.Execute(block.Data + offset + headerSize);
+				offset += header.Size;
+			}
+			block.Used = 0;
+		}
+
+		m_CurrentBlock = 0;
+		m_CommandCount = 0;
+	}
+
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Hazel {
+
+	// Recorded render commands: closures stored back to back in fixed-size blocks, run
+	// in submission order by Execute. Blocks are kept across Execute calls, so recording
+	// a frame allocates nothing once the queue has grown to its working size.
+	class RenderCommandQueue
+	{
+	public:
+		RenderCommandQueue() = default;
+		~RenderCommandQueue();
+
+		RenderCommandQueue(const RenderCommandQueue&) = delete;
+		RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+		template<typename FuncT>
+		void Submit(FuncT&& func)
+		{
+			using Command = std::decay_t<FuncT>;
+			static_assert(alignof(Command) <= Alignment, "Render command is over-aligned!");
+
+			void* storage = Allocate(sizeof(Command), [](void* command)
+			{
+				Command& fn = *(Command*)command;
+				fn();
+				fn.~Command();
+			});
+			new (storage) Command(std::forward<FuncT>(func));
+		}
+
+		// Scratch memory that stays valid until the commands recorded so far have run
+		void* AllocateData(uint32_t size) { return Allocate(size, nullptr); }
+
+		// Runs and destroys every command, then empties the queue
+		void Execute();
+
+		bool IsEmpty() const { return m_CommandCount == 0; }
+		uint32_t GetCommandCount() const { return m_CommandCount; }
+	private:
+		using ExecuteFn = void(*)(void*);
+
+		struct CommandHeader
+		{
+			ExecuteFn Execute; // Null for AllocateData blocks
+			uint32_t Size;     // Header and payload, padded to Alignment
+		};
+
+		static const uint32_t Alignment = 16;
+		static const uint32_t BlockSize = 1024 * 1024;
+
+		struct Block
+		{
+			uint8_t* Data;
+			uint32_t Capacity;
+			uint32_t Used;
+		};
+
+		void* Allocate(uint32_t size, ExecuteFn execute);
+	private:
+		std::vector<Block> m_Blocks;
+		uint32_t m_CurrentBlock = 0;
+		uint32_t m_CommandCount = 0;
+	};
+
+}
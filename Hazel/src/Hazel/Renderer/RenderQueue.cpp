@@ -0,0 +1,88 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/RenderQueue.h"
+
+namespace Hazel {
+
+	static uint64_t QuantizeDepth(float depth, uint32_t bits)
+	{
+		uint64_t maxValue = (1ull << bits) - 1;
+		float clamped = std::min(std::max(depth, 0.0f), 1.0f);
+		return (uint64_t)(clamped * (float)maxValue);
+	}
+
+	static uint64_t Field(uint32_t value, uint32_t bits)
+	{
+		return (uint64_t)value & ((1ull << bits) - 1);
+	}
+
+	uint64_t RenderKey::Opaque(uint8_t layer, uint32_t shader, uint32_t material, uint32_t texture, float depth)
+	{
+		return ((uint64_t)layer << 56)
+			| (Field(shader, 12) << 43)
+			| (Field(material, 12) << 31)
+			| (Field(texture, 12) << 19)
+			| QuantizeDepth(depth, 19);
+	}
+
+	uint64_t RenderKey::Translucent(uint8_t layer, float depth, uint32_t shader, uint32_t material, uint32_t texture)
+	{
+		return ((uint64_t)layer << 56)
+			| (1ull << 55)
+			| (QuantizeDepth(1.0f - depth, 24) << 30)
+			| (Field(shader, 10) << 20)
+			| (Field(material, 10) << 10)
+			| Field(texture, 10);
+	}
+
+	uint64_t RenderKey::Sequenced(uint8_t layer, bool translucent, float depth, uint32_t sequence)
+	{
+		HZ_CORE_ASSERT((sequence & SequenceMask) == sequence, "Sequence number out of range!");
+
+		return ((uint64_t)layer << 56)
+			| ((uint64_t)translucent << 55)
+			| (QuantizeDepth(translucent ? 1.0f - depth : depth, 24) << 31)
+			| (sequence & SequenceMask);
+	}
+
+	void RenderQueue::Sort()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		uint32_t count = (uint32_t)m_Entries.size();
+		if (count < 2)
+			return;
+
+		// LSD radix sort, one byte per pass; LSD is stable by construction
+		m_Scratch.resize(count);
+		Entry* source = m_Entries.data();
+		Entry* destination = m_Scratch.data();
+
+		for (uint32_t shift = 0; shift < 64; shift += 8)
+		{
+			uint32_t histogram[256] = {};
+			for (uint32_t i = 0; i < count; i++)
+				histogram[(source[i].Key >> shift) & 0xff]++;
+
+			// Every key shares this byte, the pass would be a plain copy
+			if (histogram[(source[0].Key >> shift) & 0xff] == count)
+				continue;
+
+			uint32_t offset = 0;
+			for (uint32_t& bucket : histogram)
+			{
+				uint32_t bucketCount = bucket;
+				bucket = offset;
+				offset += bucketCount;
+			}
+
+			for (uint32_t i = 0; i < count; i++)
+				destination[histogram[(source[i].Key >> shift) & 0xff]++] = source[i];
+
+			std::swap(source, destination);
+		}
+
+		if (source != m_Entries.data())
+			m_Entries.swap(m_Scratch);
+	}
+
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <vector>
+
+namespace Hazel {
+
+	// Everything that decides draw order, packed so that sorting the keys as plain
+	// integers yields the execution order. Layout, most significant bit first:
+	//
+	//   opaque:      layer:8 | 0:1 | shader:12 | material:12 | texture:12 | depth:19 (front-to-back)
+	//   translucent: layer:8 | 1:1 | depth:24 (back-to-front) | shader:10 | material:10 | texture:10
+	//   sequenced:   layer:8 | translucent:1 | depth:24 (front-to-back when opaque) | sequence:31
+	//
+	// Opaque draws are grouped by state since the depth test resolves visibility; translucent
+	// ones must blend in depth order and only use state to break ties. Ids are truncated to
+	// their field width: a collision only costs a redundant bind, never a wrong draw.
+	// Sequenced keys are for draws that share all state: at equal depth, submission order
+	// decides, so the first of two coplanar opaque draws wins the depth test and
+	// translucent ones blend in the order they were drawn.
+	// Depth is normalized to [0, 1] with 0 nearest the viewer.
+	struct RenderKey
+	{
+		static uint64_t Opaque(uint8_t layer, uint32_t shader, uint32_t material, uint32_t texture, float depth);
+		static uint64_t Translucent(uint8_t layer, float depth, uint32_t shader, uint32_t material, uint32_t texture);
+		static uint64_t Sequenced(uint8_t layer, bool translucent, float depth, uint32_t sequence);
+
+		// Replaces the sequence of a sequenced key, e.g. when merging separately recorded queues
+		static uint64_t WithSequence(uint64_t key, uint32_t sequence) { return (key & ~SequenceMask) | (sequence & SequenceMask); }
+
+		static bool IsTranslucent(uint64_t key) { return (key >> 55) & 1; }
+		static uint8_t GetLayer(uint64_t key) { return (uint8_t)(key >> 56); }
+	private:
+		static const uint64_t SequenceMask = (1ull << 31) - 1;
+	};
+
+	// Collects sort keys for a scene. Callers keep the actual draw data in their own
+	// storage and push its index alongside the key; after Sort() the entries come back in
+	// execution order. The sort is stable, so equal keys keep submission order.
+	class RenderQueue
+	{
+	public:
+		struct Entry
+		{
+			uint64_t Key;
+			uint32_t Index;
+		};
+	public:
+		inline void Push(uint64_t key, uint32_t index) { m_Entries.push_back({ key, index }); }
+
+		void Sort();
+		void Clear() { m_Entries.clear(); }
+
+		inline bool Empty() const { return m_Entries.empty(); }
+		inline uint32_t Size() const { return (uint32_t)m_Entries.size(); }
+
+		std::vector<Entry>::const_iterator begin() const { return m_Entries.begin(); }
+		std::vector<Entry>::const_iterator end() const { return m_Entries.end(); }
+	private:
+		std::vector<Entry> m_Entries;
+		std::vector<Entry> m_Scratch;
+	};
+
+}
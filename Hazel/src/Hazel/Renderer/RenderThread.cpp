@@ -0,0 +1,262 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/RenderThread.h"
+
+#include "Hazel/Renderer/GraphicsContext.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Hazel {
+
+	struct RenderThreadData
+	{
+		std::thread Thread;
+		GraphicsContext* Context = nullptr;
+		std::atomic<bool> Running = false;
+
+		// The main thread records into Queues[SubmitIndex]; the other one belongs to the
+		// render thread while Kicked is set
+		RenderCommandQueue Queues[2];
+		uint32_t SubmitIndex = 0;
+
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		bool Kicked = false;
+
+		// Submitted by threads that cannot record, guarded by Mutex. Threads append to
+		// OtherQueues[OtherIndex] while the render thread runs the other one.
+		RenderCommandQueue OtherQueues[2];
+		uint32_t OtherIndex = 0;
+		uint64_t OtherSubmitted = 0;
+		uint64_t OtherExecuted = 0;
+
+		// Resources released on threads that cannot record, guarded by DestroyMutex
+		std::vector<std::function<void()>> PendingDestroys;
+		std::mutex DestroyMutex;
+	};
+
+	static RenderThreadData s_Data;
+
+	void RenderThread::Start(GraphicsContext& context)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(!s_Data.Running, "Render thread is already running!");
+
+		s_Data.Context = &context;
+		s_Data.SubmitIndex = 0;
+		s_Data.Kicked = false;
+		s_Data.Running = true;
+
+		// A context can only be current on one thread at a time
+		context.ReleaseCurrent();
+		s_Data.Thread = std::thread(ThreadMain);
+
+		s_IsRecording = true;
+	}
+
+	void RenderThread::Stop()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!s_Data.Running)
+			return;
+
+		Flush();
+		s_IsRecording = false;
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data.Mutex);
+			s_Data.Running = false;
+		}
+		s_Data.Condition.notify_all();
+		s_Data.Thread.join();
+
+		s_Data.Context->MakeCurrent();
+		s_Data.Context = nullptr;
+
+		// Anything released by other threads since the last frame
+		std::vector<std::function<void()>> destroys;
+		{
+			std::lock_guard<std::mutex> lock(s_Data.DestroyMutex);
+			destroys.swap(s_Data.PendingDestroys);
+		}
+		for (auto& destroy : destroys)
+			destroy();
+	}
+
+	bool RenderThread::IsRunning()
+	{
+		return s_Data.Running;
+	}
+
+	void* RenderThread::AllocateFrameData(const void* data, uint32_t size)
+	{
+		HZ_CORE_ASSERT(s_IsRecording, "Frame data only exists while recording!");
+
+		void* copy = GetSubmitQueue().AllocateData(size);
+		memcpy(copy, data, size);
+		return copy;
+	}
+
+	void RenderThread::EndFrame()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!s_IsRecording)
+			return;
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data.DestroyMutex);
+			for (auto& destroy : s_Data.PendingDestroys)
+				GetSubmitQueue().Submit(std::move(destroy));
+			s_Data.PendingDestroys.clear();
+		}
+
+		// Frame N-1 must be done before its queue can be recorded into again
+		WaitForIdle();
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data.Mutex);
+			s_Data.SubmitIndex ^= 1;
+			s_Data.Kicked = true;
+		}
+		s_Data.Condition.notify_all();
+	}
+
+	void RenderThread::Flush()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!s_IsRecording)
+			return;
+
+		EndFrame();
+		WaitForIdle();
+	}
+
+	RenderCommandQueue& RenderThread::GetSubmitQueue()
+	{
+		return s_Data.Queues[s_Data.SubmitIndex];
+	}
+
+	std::mutex& RenderThread::GetOtherThreadMutex()
+	{
+		return s_Data.Mutex;
+	}
+
+	RenderCommandQueue& RenderThread::GetOtherThreadQueue()
+	{
+		return s_Data.OtherQueues[s_Data.OtherIndex];
+	}
+
+	uint64_t RenderThread::OnOtherThreadSubmit()
+	{
+		uint64_t ticket = ++s_Data.OtherSubmitted;
+		s_Data.Condition.notify_all();
+		return ticket;
+	}
+
+	void RenderThread::WaitForOtherThreadCommands(uint64_t ticket)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		// The render thread drains the side queue before it exits, so this always returns
+		std::unique_lock<std::mutex> lock(s_Data.Mutex);
+		s_Data.Condition.wait(lock, [ticket] { return s_Data.OtherExecuted >= ticket; });
+	}
+
+	void RenderThread::Destroy(std::function<void()> deleter)
+	{
+		if (s_IsRecording)
+		{
+			GetSubmitQueue().Submit(std::move(deleter));
+			return;
+		}
+
+		if (!s_Data.Running || s_IsRenderThread)
+		{
+			deleter();
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(s_Data.DestroyMutex);
+		s_Data.PendingDestroys.push_back(std::move(deleter));
+	}
+
+	void RenderThread::WaitForIdle()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::unique_lock<std::mutex> lock(s_Data.Mutex);
+		s_Data.Condition.wait(lock, [] { return !s_Data.Kicked; });
+	}
+
+	void RenderThread::ThreadMain()
+	{
+		HZ_PROFILE_THREAD("Render Thread");
+
+		s_IsRenderThread = true;
+		s_Data.Context->MakeCurrent();
+
+		while (true)
+		{
+			RenderCommandQueue* queue = nullptr;
+			RenderCommandQueue* otherQueue = nullptr;
+			uint64_t otherTicket = 0;
+			{
+				std::unique_lock<std::mutex> lock(s_Data.Mutex);
+				s_Data.Condition.wait(lock, []
+				{
+					return s_Data.Kicked || !s_Data.Running || s_Data.OtherSubmitted != s_Data.OtherExecuted;
+				});
+
+				if (s_Data.OtherSubmitted != s_Data.OtherExecuted)
+				{
+					otherQueue = &s_Data.OtherQueues[s_Data.OtherIndex];
+					otherTicket = s_Data.OtherSubmitted;
+					s_Data.OtherIndex ^= 1;
+				}
+
+				if (s_Data.Kicked)
+					queue = &s_Data.Queues[s_Data.SubmitIndex ^ 1];
+				else if (!otherQueue)
+					break; // Stopped, and nobody is waiting on us any more
+			}
+
+			if (otherQueue)
+			{
+				{
+					HZ_PROFILE_SCOPE("RenderThread Other Threads");
+					otherQueue->Execute();
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(s_Data.Mutex);
+					s_Data.OtherExecuted = otherTicket;
+				}
+				s_Data.Condition.notify_all();
+			}
+
+			if (queue)
+			{
+				{
+					HZ_PROFILE_SCOPE("RenderThread Frame");
+					queue->Execute();
+				}
+
+				{
+					std::lock_guard<std::mutex> lock(s_Data.Mutex);
+					s_Data.Kicked = false;
+				}
+				s_Data.Condition.notify_all();
+			}
+		}
+
+		s_Data.Context->ReleaseCurrent();
+		s_IsRenderThread = false;
+	}
+
+}
@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Hazel/Core/Core.h"
+#include "Hazel/Renderer/RenderCommandQueue.h"
+
+#include <mutex>
+
+namespace Hazel {
+
+	class GraphicsContext;
+
+	// Optional render thread that owns the graphics context. While it runs, the main
+	// thread records frame N into one command queue and the render thread executes
+	// frame N-1 from the other; EndFrame is the fence between the two.
+	//
+	// Everything that talks to the graphics API goes through Submit. When the thread is
+	// not running, or when called from the render thread itself, Submit runs the
+	// function at once, so the same code works in both modes. Recording is single
+	// threaded: only the thread that called Start records into frames. Submissions from
+	// any other thread (jobs, loader workers) go to a locked side queue that the render
+	// thread runs between frames.
+	class RenderThread
+	{
+	public:
+		// Hands the context over to a new render thread; call with nothing recorded
+		static void Start(GraphicsContext& context);
+		// Runs everything recorded, joins the thread and makes the context current here again
+		static void Stop();
+
+		static bool IsRunning();
+		static bool IsRenderThread() { return s_IsRenderThread; }
+		// True on the main thread while the render thread runs: submissions are deferred
+		static bool IsRecording() { return s_IsRecording; }
+
+		template<typename FuncT>
+		static void Submit(FuncT&& func)
+		{
+			if (s_IsRecording)
+			{
+				GetSubmitQueue().Submit(std::forward<FuncT>(func));
+				return;
+			}
+
+			if (IsRunning() && !s_IsRenderThread)
+			{
+				SubmitFromOtherThread(std::forward<FuncT>(func));
+				return;
+			}
+
+			func();
+		}
+
+		// Submits func and blocks until it has run, together with everything before it.
+		// For resource creation and other calls whose result is needed right away.
+		// From threads other than the recording one, only func is waited for.
+		template<typename FuncT>
+		static void ExecuteSync(FuncT&& func)
+		{
+			if (s_IsRecording)
+			{
+				GetSubmitQueue().Submit(std::forward<FuncT>(func));
+				Flush();
+				return;
+			}
+
+			if (IsRunning() && !s_IsRenderThread)
+			{
+				if (uint64_t ticket = SubmitFromOtherThread(std::forward<FuncT>(func)))
+					WaitForOtherThreadCommands(ticket);
+				return;
+			}
+
+			func();
+		}
+
+		// Copy of data that commands recorded this frame can read when they run
+		static void* AllocateFrameData(const void* data, uint32_t size);
+
+		// Creates an API object on the render thread. The returned Ref deletes it there
+		// as well, after every command recorded before the last reference went away, so
+		// commands may keep raw pointers to resources that are alive when recorded.
+		template<typename T, typename... Args>
+		static Ref<T> CreateResource(Args&&... args)
+		{
+			T* resource = nullptr;
+			ExecuteSync([&]() { resource = new T(std::forward<Args>(args)...); });
+			return Ref<T>(resource, [](T* resource) { Destroy([resource]() { delete resource; }); });
+		}
+
+		// Hands the frame recorded so far to the render thread, once it has finished the
+		// previous one. Does nothing unless recording.
+		static void EndFrame();
+		// Like EndFrame, then waits until the render thread is idle
+		static void Flush();
+	private:
+		static RenderCommandQueue& GetSubmitQueue();
+
+		// Queues func for the render thread; returns the ticket to wait for, or 0 when the
+		// render thread has stopped in the meantime and func ran right here instead
+		template<typename FuncT>
+		static uint64_t SubmitFromOtherThread(FuncT&& func)
+		{
+			{
+				std::lock_guard<std::mutex> lock(GetOtherThreadMutex());
+				if (IsRunning())
+				{
+					GetOtherThreadQueue().Submit(std::forward<FuncT>(func));
+					return OnOtherThreadSubmit();
+				}
+			}
+
+			func();
+			return 0;
+		}
+
+		// The queue and the counters below are guarded by GetOtherThreadMutex()
+		static std::mutex& GetOtherThreadMutex();
+		static RenderCommandQueue& GetOtherThreadQueue();
+		static uint64_t OnOtherThreadSubmit();
+		static void WaitForOtherThreadCommands(uint64_t ticket);
+
+		// Deletes from any thread: those that cannot record hand the deleter to EndFrame
+		static void Destroy(std::function<void()> deleter);
+		static void WaitForIdle();
+		static void ThreadMain();
+	private:
+		inline static thread_local bool s_IsRecording = false;
+		inline static thread_local bool s_IsRenderThread = false;
+	};
+
+}
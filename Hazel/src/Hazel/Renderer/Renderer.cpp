@@ -1,22 +1,52 @@
 #include "hzpch.h"
 #include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/AssetManager.h"
 #include "Hazel/Renderer/Renderer2D.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Renderer/ShaderReloader.h"
+#include "Hazel/Renderer/TextureLoader.h"
+#include "Hazel/Renderer/TextureResidency.h"
+
+#include <mutex>
 
 namespace Hazel {
 
 	Scope<Renderer::SceneData> Renderer::s_SceneData = CreateScope<Renderer::SceneData>();
 
+	// Published by EndFrame's command, which may run on the render thread
+	static RendererAPI::StateStatistics s_FrameStateStatistics;
+	static std::mutex s_FrameStatisticsMutex;
+
 	void Renderer::Init()
 	{
 		HZ_PROFILE_FUNCTION();
 
 		RenderCommand::Init();
+
+	#ifndef HZ_DIST
+		ShaderReloader::Init();
+	#endif
+
+		TextureLoader::Init();
+		TextureResidency::Init();
+		AssetManager::Init();
+
+		s_SceneData->CameraUniformBuffer = UniformBuffer::Create(sizeof(CameraData), UniformBinding::Camera);
+
 		Renderer2D::Init();
 	}
 
 	void Renderer::Shutdown()
 	{
 		Renderer2D::Shutdown();
+
+		s_SceneData->CameraUniformBuffer = nullptr;
+		s_SceneData->Shaders.Clear();
+		AssetManager::Shutdown();
+
+		ShaderReloader::Shutdown();
+		TextureResidency::Shutdown();
+		TextureLoader::Shutdown();
 	}
 
 	void Renderer::OnWindowResize(uint32_t width, uint32_t height)
@@ -27,20 +57,112 @@ namespace Hazel {
 	void Renderer::BeginScene(OrthographicCamera& camera)
 	{
 		s_SceneData->ViewProjectionMatrix = camera.GetViewProjectionMatrix();
+		s_SceneData->Layer = 0;
+
+		SetCameraData(camera.GetViewProjectionMatrix());
 	}
 
 	void Renderer::EndScene()
 	{
+		HZ_PROFILE_FUNCTION();
+
+		s_SceneData->Queue.Sort();
+
+		if (RenderThread::IsRecording())
+		{
+			// The commands are reused next frame, so the render thread gets its own sorted copy
+			std::vector<SubmitCommand> commands;
+			commands.reserve(s_SceneData->Commands.size());
+			for (const auto& entry : s_SceneData->Queue)
+				commands.push_back(s_SceneData->Commands[entry.Index]);
+
+			RenderThread::Submit([commands = std::move(commands)]()
+			{
+				for (const auto& command : commands)
+					DrawCommand(command);
+			});
+		}
+		else
+		{
+			for (const auto& entry : s_SceneData->Queue)
+				DrawCommand(s_SceneData->Commands[entry.Index]);
+		}
+
+		s_SceneData->Queue.Clear();
+		s_SceneData->Commands.clear();
 	}
 
-	void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform)
+	void Renderer::EndFrame()
 	{
-		shader->Bind();
-		shader->SetMat4("u_ViewProjection", s_SceneData->ViewProjectionMatrix);
-		shader->SetMat4("u_Transform", transform);
+		HZ_PROFILE_FUNCTION();
 
-		vertexArray->Bind();
-		RenderCommand::DrawIndexed(vertexArray);
+		RenderCommand::EndFrame();
+
+		RenderThread::Submit([]()
+		{
+			RendererAPI::StateStatistics stats = RenderCommand::GetStateStatistics();
+			HZ_PROFILE_COUNTER("StateCache", {
+				{ "Issued", stats.Issued },
+				{ "Skipped", stats.Skipped }
+			});
+			RenderCommand::ResetStateStatistics();
+
+			std::lock_guard<std::mutex> lock(s_FrameStatisticsMutex);
+			s_FrameStateStatistics = stats;
+		});
+	}
+
+	RendererAPI::StateStatistics Renderer::GetStateStatistics()
+	{
+		std::lock_guard<std::mutex> lock(s_FrameStatisticsMutex);
+		return s_FrameStateStatistics;
+	}
+
+	void Renderer::DrawCommand(const SubmitCommand& command)
+	{
+		command.Shader->Bind();
+		command.Shader->SetMat4("u_Transform", command.Transform);
+
+		if (command.Texture)
+			command.Texture->Bind();
+
+		command.VertexArray->Bind();
+		RenderCommand::DrawIndexed(command.VertexArray);
+	}
+
+	void Renderer::Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform, const Ref<Texture2D>& texture)
+	{
+		// Depth of the object's origin, mapped from NDC to [0, 1]
+		glm::vec4 clipPosition = s_SceneData->ViewProjectionMatrix * transform[3];
+		float depth = (clipPosition.z / clipPosition.w) * 0.5f + 0.5f;
+
+		// Not the renderer IDs: the render thread may be swapping those in a reload right now
+		uint32_t textureID = texture ? texture->GetID() : 0;
+		bool translucent = texture && texture->HasAlpha();
+		uint64_t key = translucent
+			? RenderKey::Translucent(s_SceneData->Layer, depth, shader->GetID(), 0, textureID)
+			: RenderKey::Opaque(s_SceneData->Layer, shader->GetID(), 0, textureID, depth);
+
+		s_SceneData->Queue.Push(key, (uint32_t)s_SceneData->Commands.size());
+		s_SceneData->Commands.push_back({ shader, vertexArray, texture, transform });
+	}
+
+	void Renderer::SetCameraData(const glm::mat4& viewProjection)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		CameraData& camera = s_SceneData->Camera;
+		if (s_SceneData->CameraUploaded && memcmp(&camera.ViewProjection, &viewProjection, sizeof(glm::mat4)) == 0)
+			return;
+
+		camera.ViewProjection = viewProjection;
+		RenderThread::Submit([buffer = s_SceneData->CameraUniformBuffer.get(), camera]() { buffer->SetData(&camera, sizeof(CameraData)); });
+		s_SceneData->CameraUploaded = true;
+	}
+
+	void Renderer::SetLayer(uint8_t layer)
+	{
+		s_SceneData->Layer = layer;
 	}
 
 }
\ No newline at end of file
@@ -4,6 +4,9 @@
 
 #include "Hazel/Renderer/OrthographicCamera.h"
 #include "Hazel/Renderer/Shader.h"
+#include "Hazel/Renderer/Texture.h"
+#include "Hazel/Renderer/RenderQueue.h"
+#include "Hazel/Renderer/UniformBuffer.h"
 
 namespace Hazel {
 
@@ -18,15 +21,61 @@ namespace Hazel {
 		static void BeginScene(OrthographicCamera& camera);
 		static void EndScene();
 
-		static void Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f));
+		// Once per frame, after the last draw: fences the frame's stream buffer writes,
+		// records its graphics state changes as a "StateCache" profiler counter and starts
+		// counting again
+		static void EndFrame();
+		// State changes of the last finished frame
+		static RendererAPI::StateStatistics GetStateStatistics();
+
+		// Submissions are sorted by state and depth and drawn at EndScene; the texture,
+		// if any, is bound to slot 0. Shader uniforms other than u_Transform must not
+		// change between submissions that rely on different values.
+		static void Submit(const Ref<Shader>& shader, const Ref<VertexArray>& vertexArray, const glm::mat4& transform = glm::mat4(1.0f), const Ref<Texture2D>& texture = nullptr);
+
+		// Sort layer for subsequent submissions; lower layers draw first. BeginScene resets it to 0
+		static void SetLayer(uint8_t layer);
+
+		// Uploads the camera block every shader reads at UniformBinding::Camera.
+		// BeginScene of both renderers call this; unchanged data is not re-uploaded.
+		static void SetCameraData(const glm::mat4& viewProjection);
+
+		// Engine-wide shaders and their permutations; cleared at Shutdown
+		static ShaderLibrary& GetShaderLibrary() { return s_SceneData->Shaders; }
 
 		inline static RendererAPI::API GetAPI() { return RendererAPI::GetAPI(); }
 	private:
+		struct SubmitCommand
+		{
+			Ref<Hazel::Shader> Shader;
+			Ref<Hazel::VertexArray> VertexArray;
+			Ref<Texture2D> Texture;
+			glm::mat4 Transform;
+		};
+
+		// Mirrors the std140 Camera block in the shaders
+		struct CameraData
+		{
+			glm::mat4 ViewProjection;
+		};
+
 		struct SceneData
 		{
 			glm::mat4 ViewProjectionMatrix;
+
+			CameraData Camera;
+			Ref<UniformBuffer> CameraUniformBuffer;
+			bool CameraUploaded = false;
+
+			uint8_t Layer = 0;
+			std::vector<SubmitCommand> Commands;
+			RenderQueue Queue;
+
+			ShaderLibrary Shaders;
 		};
 
+		static void DrawCommand(const SubmitCommand& command);
+
 		static Scope<SceneData> s_SceneData;
 	};
 }
@@ -1,76 +1,655 @@
 #include "hzpch.h"
 #include "Hazel/Renderer/Renderer2D.h"
 
+#include "Hazel/Renderer/Renderer.h"
 #include "Hazel/Renderer/VertexArray.h"
 #include "Hazel/Renderer/Shader.h"
 #include "Hazel/Renderer/RenderCommand.h"
+#include "Hazel/Renderer/RenderQueue.h"
+#include "Hazel/Renderer/RenderThread.h"
 
 #include <glm/gtc/matrix_transform.hpp>
 
+#include <atomic>
+#include <mutex>
+
 namespace Hazel {
 
+	struct QuadVertex
+	{
+		glm::vec3 Position;
+		glm::vec4 Color;
+		glm::vec2 TexCoord;
+		float TexIndex;
+		float TilingFactor;
+	};
+
+	// Per-sprite record for the instanced path; the corners are expanded in the vertex shader
+	struct QuadInstance
+	{
+		glm::vec3 Position;
+		glm::vec2 Size;
+		float Rotation;
+		glm::vec4 Color;
+		glm::vec4 TexRect; // min.xy, max.xy
+		float TexIndex;
+		float TilingFactor;
+	};
+
+	// A DrawQuad call held back until the scene is sorted; the texture is kept alive by
+	// its submit context
+	struct QuadCommand
+	{
+		glm::vec3 Position;
+		glm::vec2 Size;
+		float Rotation;
+		glm::vec4 Color;
+		const Texture2D* Texture;
+		glm::vec4 TexRect;
+		float TilingFactor;
+	};
+
+	// Quads recorded by one thread; merged into the main context at EndScene
+	struct SubmitContext
+	{
+		std::vector<QuadCommand> QuadCommands;
+		RenderQueue QuadQueue;
+		uint8_t Layer = 0;
+		uint32_t Order = 0;
+
+		// One reference per texture drawn this scene, so none is freed before EndScene
+		std::vector<Ref<Texture2D>> Textures;
+		std::unordered_set<const Texture2D*> TextureSet;
+		const Texture2D* LastTexture = nullptr;
+
+		// True the first time texture is drawn in this scene
+		bool IsNewTexture(const Texture2D* texture)
+		{
+			if (texture == LastTexture)
+				return false;
+
+			LastTexture = texture;
+			return TextureSet.insert(texture).second;
+		}
+
+		void Clear()
+		{
+			QuadCommands.clear();
+			QuadQueue.Clear();
+			Layer = 0;
+
+			Textures.clear();
+			TextureSet.clear();
+			LastTexture = nullptr;
+		}
+	};
+
 	struct Renderer2DStorage
 	{
+		static const uint32_t DefaultMaxQuads = 10000;
+		static const uint32_t MaxTextureSlots = 32; // Must match u_Textures in Texture.glsl
+		static constexpr const char* TextureShaderPath = "assets/shaders/Texture.glsl";
+
+		uint32_t MaxQuads = 0;
+		uint32_t MaxVertices = 0;
+		uint32_t MaxIndices = 0;
+
 		Ref<VertexArray> QuadVertexArray;
+		Ref<VertexBuffer> QuadVertexBuffer;
 		Ref<Shader> TextureShader;
 		Ref<Texture2D> WhiteTexture;
+
+		Ref<VertexArray> QuadInstanceVertexArray;
+		Ref<VertexBuffer> QuadInstanceBuffer;
+		Ref<Shader> InstancedTextureShader; // INSTANCED permutation
+
+		bool Instancing = false;
+
+		uint32_t QuadCount = 0;
+		QuadVertex* QuadVertexBufferBase = nullptr;
+		QuadVertex* QuadVertexBufferPtr = nullptr;
+		QuadInstance* QuadInstanceBufferBase = nullptr;
+		QuadInstance* QuadInstanceBufferPtr = nullptr;
+
+		// Textures are deduplicated by identity; slot 0 is always the white texture
+		std::array<const Texture2D*, MaxTextureSlots> TextureSlots;
+		uint32_t TextureSlotCount = 0;
+		uint32_t TextureSlotIndex = 1;
+
+		// Submissions of the current scene, replayed into batches in key order at EndScene.
+		// Main-thread draws go straight into MainContext; worker contexts are pooled.
+		SubmitContext MainContext;
+		std::vector<Scope<SubmitContext>> FreeContexts;
+		std::vector<Scope<SubmitContext>> PendingContexts;
+		std::mutex ContextMutex;
+		std::atomic<uint32_t> ActiveContexts = 0;
+		glm::mat4 ViewProjection;
+
+		glm::vec2 QuadVertexPositions[4];
+		glm::vec2 QuadTexCoords[4];
+
+		Renderer2D::Statistics Stats;
 	};
 
 	static Renderer2DStorage* s_Data;
 
-	void Renderer2D::Init()
+	// Set between BeginSubmit and EndSubmit on a worker thread
+	static thread_local SubmitContext* s_SubmitContext = nullptr;
+
+	static SubmitContext& GetSubmitContext()
+	{
+		return s_SubmitContext ? *s_SubmitContext : s_Data->MainContext;
+	}
+
+	static void CreateQuadBuffers(uint32_t maxQuads)
 	{
 		HZ_PROFILE_FUNCTION();
 
-		s_Data = new Renderer2DStorage();
+		s_Data->MaxQuads = maxQuads;
+		s_Data->MaxVertices = maxQuads * 4;
+		s_Data->MaxIndices = maxQuads * 6;
+
 		s_Data->QuadVertexArray = VertexArray::Create();
 
-		float squareVertices[5 * 4] = {
-			-0.5f, -0.5f, 0.0f, 0.0f, 0.0f,
-			 0.5f, -0.5f, 0.0f, 1.0f, 0.0f,
-			 0.5f,  0.5f, 0.0f, 1.0f, 1.0f,
-			-0.5f,  0.5f, 0.0f, 0.0f, 1.0f
+		s_Data->QuadVertexBuffer = VertexBuffer::Create(s_Data->MaxVertices * sizeof(QuadVertex), VertexBufferUsage::Stream);
+		s_Data->QuadVertexBuffer->SetLayout({
+			{ ShaderDataType::Float3, "a_Position" },
+			{ ShaderDataType::Float4, "a_Color" },
+			{ ShaderDataType::Float2, "a_TexCoord" },
+			{ ShaderDataType::Float, "a_TexIndex" },
+			{ ShaderDataType::Float, "a_TilingFactor" }
+		});
+		s_Data->QuadVertexArray->AddVertexBuffer(s_Data->QuadVertexBuffer);
+
+		delete[] s_Data->QuadVertexBufferBase;
+		s_Data->QuadVertexBufferBase = new QuadVertex[s_Data->MaxVertices];
+		s_Data->QuadVertexBufferPtr = s_Data->QuadVertexBufferBase;
+
+		uint32_t* quadIndices = new uint32_t[s_Data->MaxIndices];
+
+		uint32_t offset = 0;
+		for (uint32_t i = 0; i < s_Data->MaxIndices; i += 6)
+		{
+			quadIndices[i + 0] = offset + 0;
+			quadIndices[i + 1] = offset + 1;
+			quadIndices[i + 2] = offset + 2;
+
+			quadIndices[i + 3] = offset + 2;
+			quadIndices[i + 4] = offset + 3;
+			quadIndices[i + 5] = offset + 0;
+
+			offset += 4;
+		}
+
+		Ref<IndexBuffer> quadIB = IndexBuffer::Create(quadIndices, s_Data->MaxIndices);
+		s_Data->QuadVertexArray->SetIndexBuffer(quadIB);
+		delete[] quadIndices;
+
+		// Instanced path: one shared unit quad plus a per-instance stream
+		s_Data->QuadInstanceVertexArray = VertexArray::Create();
+
+		float unitQuadVertices[4 * 4] = {
+			-0.5f, -0.5f, 0.0f, 0.0f,
+			 0.5f, -0.5f, 1.0f, 0.0f,
+			 0.5f,  0.5f, 1.0f, 1.0f,
+			-0.5f,  0.5f, 0.0f, 1.0f
 		};
 
-		Ref<VertexBuffer> squareVB = VertexBuffer::Create(squareVertices, sizeof(squareVertices));
-		squareVB->SetLayout({
-			{ ShaderDataType::Float3, "a_Position" },
+		Ref<VertexBuffer> unitQuadVB = VertexBuffer::Create(unitQuadVertices, sizeof(unitQuadVertices));
+		unitQuadVB->SetLayout({
+			{ ShaderDataType::Float2, "a_Position" },
 			{ ShaderDataType::Float2, "a_TexCoord" }
 		});
-		s_Data->QuadVertexArray->AddVertexBuffer(squareVB);
+		s_Data->QuadInstanceVertexArray->AddVertexBuffer(unitQuadVB);
+
+		s_Data->QuadInstanceBuffer = VertexBuffer::Create(s_Data->MaxQuads * sizeof(QuadInstance), VertexBufferUsage::Stream);
+		s_Data->QuadInstanceBuffer->SetLayout({
+			{ ShaderDataType::Float3, "i_Position",     false, 1 },
+			{ ShaderDataType::Float2, "i_Size",         false, 1 },
+			{ ShaderDataType::Float,  "i_Rotation",     false, 1 },
+			{ ShaderDataType::Float4, "i_Color",        false, 1 },
+			{ ShaderDataType::Float4, "i_TexRect",      false, 1 },
+			{ ShaderDataType::Float,  "i_TexIndex",     false, 1 },
+			{ ShaderDataType::Float,  "i_TilingFactor", false, 1 }
+		});
+		s_Data->QuadInstanceVertexArray->AddVertexBuffer(s_Data->QuadInstanceBuffer);
+
+		uint32_t unitQuadIndices[6] = { 0, 1, 2, 2, 3, 0 };
+		Ref<IndexBuffer> unitQuadIB = IndexBuffer::Create(unitQuadIndices, sizeof(unitQuadIndices) / sizeof(uint32_t));
+		s_Data->QuadInstanceVertexArray->SetIndexBuffer(unitQuadIB);
+
+		delete[] s_Data->QuadInstanceBufferBase;
+		s_Data->QuadInstanceBufferBase = new QuadInstance[s_Data->MaxQuads];
+		s_Data->QuadInstanceBufferPtr = s_Data->QuadInstanceBufferBase;
+
+		s_Data->QuadCount = 0;
+	}
+
+	// GPU half of a flush, recorded as one command while a render thread runs
+	struct QuadBatch
+	{
+		std::array<const Texture2D*, Renderer2DStorage::MaxTextureSlots> Textures;
+		uint32_t TextureCount;
+		uint32_t QuadCount;
+		Ref<Hazel::VertexArray> VertexArray;
+		VertexBuffer* Buffer;
+		Hazel::Shader* Shader;
+		bool Instancing;
+	};
+
+	static void DrawBatch(const QuadBatch& batch, const void* data, uint32_t dataSize)
+	{
+		for (uint32_t i = 0; i < batch.TextureCount; i++)
+			batch.Textures[i]->Bind(i);
+
+		batch.Buffer->SetData(data, dataSize);
+		batch.Shader->Bind();
+		batch.VertexArray->Bind();
+
+		if (batch.Instancing)
+		{
+			uint32_t baseInstance = batch.Buffer->GetDrawOffset() / sizeof(QuadInstance);
+			RenderCommand::DrawIndexedInstanced(batch.VertexArray, 6, batch.QuadCount, baseInstance);
+		}
+		else
+		{
+			uint32_t baseVertex = batch.Buffer->GetDrawOffset() / sizeof(QuadVertex);
+			RenderCommand::DrawIndexed(batch.VertexArray, batch.QuadCount * 6, baseVertex);
+		}
+	}
+
+	// Draws the current batch; only called while replaying the sorted scene
+	static void Flush()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (s_Data->QuadCount == 0)
+			return; // Nothing to draw
+
+		QuadBatch batch;
+		batch.Textures = s_Data->TextureSlots;
+		batch.TextureCount = s_Data->TextureSlotIndex;
+		batch.QuadCount = s_Data->QuadCount;
+		batch.Instancing = s_Data->Instancing;
+
+		const void* data;
+		uint32_t dataSize;
+		if (s_Data->Instancing)
+		{
+			batch.VertexArray = s_Data->QuadInstanceVertexArray;
+			batch.Buffer = s_Data->QuadInstanceBuffer.get();
+			batch.Shader = s_Data->InstancedTextureShader.get();
+			data = s_Data->QuadInstanceBufferBase;
+			dataSize = (uint32_t)((uint8_t*)s_Data->QuadInstanceBufferPtr - (uint8_t*)s_Data->QuadInstanceBufferBase);
+		}
+		else
+		{
+			batch.VertexArray = s_Data->QuadVertexArray;
+			batch.Buffer = s_Data->QuadVertexBuffer.get();
+			batch.Shader = s_Data->TextureShader.get();
+			data = s_Data->QuadVertexBufferBase;
+			dataSize = (uint32_t)((uint8_t*)s_Data->QuadVertexBufferPtr - (uint8_t*)s_Data->QuadVertexBufferBase);
+		}
+
+		if (RenderThread::IsRecording())
+		{
+			// The CPU arrays are refilled by the next batch before this one is drawn
+			const void* copy = RenderThread::AllocateFrameData(data, dataSize);
+			RenderThread::Submit([batch = std::move(batch), copy, dataSize]() { DrawBatch(batch, copy, dataSize); });
+		}
+		else
+		{
+			DrawBatch(batch, data, dataSize);
+		}
+
+		s_Data->Stats.TextureSlotsUsed += s_Data->TextureSlotIndex;
+		s_Data->Stats.DrawCalls++;
+	}
+
+	static void StartBatch()
+	{
+		s_Data->QuadCount = 0;
+		s_Data->QuadVertexBufferPtr = s_Data->QuadVertexBufferBase;
+		s_Data->QuadInstanceBufferPtr = s_Data->QuadInstanceBufferBase;
+
+		s_Data->TextureSlotIndex = 1;
+	}
+
+	static void NextBatch()
+	{
+		Flush();
+		StartBatch();
+	}
+
+	static float GetTextureIndex(const Texture2D* texture)
+	{
+		for (uint32_t i = 0; i < s_Data->TextureSlotIndex; i++)
+		{
+			if (s_Data->TextureSlots[i] == texture)
+				return (float)i;
+		}
+
+		if (s_Data->TextureSlotIndex >= s_Data->TextureSlotCount)
+		{
+			s_Data->Stats.TextureSlotFlushes++;
+			NextBatch();
+		}
+
+		float textureIndex = (float)s_Data->TextureSlotIndex;
+		s_Data->TextureSlots[s_Data->TextureSlotIndex] = texture;
+		s_Data->TextureSlotIndex++;
+		return textureIndex;
+	}
+
+	static const glm::vec4 s_FullTexRect = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+	static void QueueQuad(const glm::vec3& position, const glm::vec2& size, float rotation,
+		const Texture2D* texture, const glm::vec4& texRect, float tilingFactor, const glm::vec4& color)
+	{
+		// The camera is orthographic, so w is 1 and NDC depth is just the clip z
+		const glm::mat4& viewProjection = s_Data->ViewProjection;
+		float clipZ = viewProjection[0][2] * position.x + viewProjection[1][2] * position.y + viewProjection[2][2] * position.z + viewProjection[3][2];
+		float depth = clipZ * 0.5f + 0.5f;
+
+		SubmitContext& context = GetSubmitContext();
+
+		// Every quad is drawn with the same program, and the texture slot table batches
+		// different textures together, so only depth and draw order decide the order
+		bool translucent = color.a < 1.0f || (texture != s_Data->WhiteTexture.get() && texture->HasAlpha());
+		uint32_t sequence = (uint32_t)context.QuadCommands.size();
+		uint64_t key = RenderKey::Sequenced(context.Layer, translucent, depth, sequence);
+
+		context.QuadQueue.Push(key, sequence);
+		context.QuadCommands.push_back({ position, size, rotation, color, texture, texRect, tilingFactor });
+	}
+
+	static void BatchQuad(const QuadCommand& command)
+	{
+		const glm::vec3& position = command.Position;
+		const glm::vec2& size = command.Size;
+		float rotation = command.Rotation;
+		const glm::vec4& color = command.Color;
+		float tilingFactor = command.TilingFactor;
+
+		if (s_Data->QuadCount >= s_Data->MaxQuads)
+		{
+			s_Data->Stats.QuadBufferFlushes++;
+			NextBatch();
+		}
+
+		float textureIndex = GetTextureIndex(command.Texture);
+
+		if (s_Data->Instancing)
+		{
+			QuadInstance& instance = *s_Data->QuadInstanceBufferPtr++;
+			instance.Position = position;
+			instance.Size = size;
+			instance.Rotation = rotation;
+			instance.Color = color;
+			instance.TexRect = command.TexRect;
+			instance.TexIndex = textureIndex;
+			instance.TilingFactor = tilingFactor;
+		}
+		else
+		{
+			float cosTheta = 1.0f, sinTheta = 0.0f;
+			if (rotation != 0.0f)
+			{
+				cosTheta = cos(rotation);
+				sinTheta = sin(rotation);
+			}
+
+			glm::vec2 texRectMin = { command.TexRect.x, command.TexRect.y };
+			glm::vec2 texRectSize = glm::vec2(command.TexRect.z, command.TexRect.w) - texRectMin;
+
+			// Bake the transform on the CPU: scale, rotate about Z, then translate
+			for (uint32_t i = 0; i < 4; i++)
+			{
+				float x = s_Data->QuadVertexPositions[i].x * size.x;
+				float y = s_Data->QuadVertexPositions[i].y * size.y;
+
+				QuadVertex& vertex = *s_Data->QuadVertexBufferPtr++;
+				vertex.Position = { position.x + x * cosTheta - y * sinTheta, position.y + x * sinTheta + y * cosTheta, position.z };
+				vertex.Color = color;
+				vertex.TexCoord = s_Data->QuadTexCoords[i] * texRectSize + texRectMin;
+				vertex.TexIndex = textureIndex;
+				vertex.TilingFactor = tilingFactor;
+			}
+		}
+
+		s_Data->QuadCount++;
+		s_Data->Stats.QuadCount++;
+	}
+
+	static Ref<Shader> LoadTextureShader(const ShaderDefines& defines)
+	{
+		Ref<Shader> shader = Renderer::GetShaderLibrary().GetPermutation(Renderer2DStorage::TextureShaderPath, defines);
+
+		std::array<int32_t, Renderer2DStorage::MaxTextureSlots> samplers;
+		for (uint32_t i = 0; i < Renderer2DStorage::MaxTextureSlots; i++)
+			samplers[i] = i < s_Data->TextureSlotCount ? i : 0;
+
+		RenderThread::Submit([shader, samplers]() mutable
+		{
+			shader->Bind();
+			shader->SetIntArray("u_Textures", samplers.data(), Renderer2DStorage::MaxTextureSlots);
+		});
+		return shader;
+	}
+
+	void Renderer2D::Init()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		s_Data = new Renderer2DStorage();
+
+		s_Data->QuadVertexPositions[0] = { -0.5f, -0.5f };
+		s_Data->QuadVertexPositions[1] = {  0.5f, -0.5f };
+		s_Data->QuadVertexPositions[2] = {  0.5f,  0.5f };
+		s_Data->QuadVertexPositions[3] = { -0.5f,  0.5f };
 
-		uint32_t squareIndices[6] = { 0, 1, 2, 2, 3, 0 };
-		Ref<IndexBuffer> squareIB = IndexBuffer::Create(squareIndices, sizeof(squareIndices) / sizeof(uint32_t));
-		s_Data->QuadVertexArray->SetIndexBuffer(squareIB);
+		s_Data->QuadTexCoords[0] = { 0.0f, 0.0f };
+		s_Data->QuadTexCoords[1] = { 1.0f, 0.0f };
+		s_Data->QuadTexCoords[2] = { 1.0f, 1.0f };
+		s_Data->QuadTexCoords[3] = { 0.0f, 1.0f };
+
+		CreateQuadBuffers(Renderer2DStorage::DefaultMaxQuads);
 
 		s_Data->WhiteTexture = Texture2D::Create(1, 1);
 		uint32_t whiteTextureData = 0xffffffff;
 		s_Data->WhiteTexture->SetData(&whiteTextureData, sizeof(uint32_t));
 
-		s_Data->TextureShader = Shader::Create("assets/shaders/Texture.glsl");
-		s_Data->TextureShader->Bind();
-		s_Data->TextureShader->SetInt("u_Texture", 0);
+		// The shader declares a fixed-size sampler array; use as much of it as the driver allows
+		s_Data->TextureSlotCount = std::min(RenderCommand::GetMaxTextureSlots(), Renderer2DStorage::MaxTextureSlots);
+
+		s_Data->TextureShader = LoadTextureShader({});
+		// Compiled up front so switching to instancing mid-run never waits on the driver
+		s_Data->InstancedTextureShader = LoadTextureShader({ { "INSTANCED", "" } });
+
+		s_Data->TextureSlots[0] = s_Data->WhiteTexture.get();
 	}
 
 	void Renderer2D::Shutdown()
 	{
 		HZ_PROFILE_FUNCTION();
 
+		delete[] s_Data->QuadVertexBufferBase;
+		delete[] s_Data->QuadInstanceBufferBase;
 		delete s_Data;
 	}
 
+	// Appends worker submissions to the main context in ascending order so the final
+	// stable sort sees the same sequence no matter how the threads were scheduled
+	static void MergeSubmitContexts()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::lock_guard<std::mutex> lock(s_Data->ContextMutex);
+
+		auto& pending = s_Data->PendingContexts;
+		std::sort(pending.begin(), pending.end(), [](const Scope<SubmitContext>& a, const Scope<SubmitContext>& b)
+		{
+			return a->Order < b->Order;
+		});
+
+		SubmitContext& main = s_Data->MainContext;
+		for (size_t i = 0; i < pending.size(); i++)
+		{
+			HZ_CORE_ASSERT(i == 0 || pending[i - 1]->Order != pending[i]->Order, "Submit orders must be unique!");
+
+			SubmitContext& context = *pending[i];
+			uint32_t baseIndex = (uint32_t)main.QuadCommands.size();
+			main.QuadCommands.insert(main.QuadCommands.end(), context.QuadCommands.begin(), context.QuadCommands.end());
+			for (const auto& entry : context.QuadQueue)
+				main.QuadQueue.Push(RenderKey::WithSequence(entry.Key, baseIndex + entry.Index), baseIndex + entry.Index);
+			main.Textures.insert(main.Textures.end(), std::make_move_iterator(context.Textures.begin()), std::make_move_iterator(context.Textures.end()));
+
+			context.Clear();
+			s_Data->FreeContexts.push_back(std::move(pending[i]));
+		}
+		pending.clear();
+	}
+
 	void Renderer2D::BeginScene(const OrthographicCamera& camera)
 	{
 		HZ_PROFILE_FUNCTION();
 
-		s_Data->TextureShader->Bind();
-		s_Data->TextureShader->SetMat4("u_ViewProjection", camera.GetViewProjectionMatrix());
+		Renderer::SetCameraData(camera.GetViewProjectionMatrix());
+
+		s_Data->ViewProjection = camera.GetViewProjectionMatrix();
+		s_Data->MainContext.Layer = 0;
+
+		StartBatch();
 	}
 
 	void Renderer2D::EndScene()
 	{
 		HZ_PROFILE_FUNCTION();
 
+		HZ_CORE_ASSERT(s_SubmitContext == nullptr, "EndScene called between BeginSubmit and EndSubmit!");
+		HZ_CORE_ASSERT(s_Data->ActiveContexts == 0, "EndScene called while worker threads are still submitting!");
+
+		SubmitContext& main = s_Data->MainContext;
+		MergeSubmitContexts();
+
+		main.QuadQueue.Sort();
+		for (const auto& entry : main.QuadQueue)
+			BatchQuad(main.QuadCommands[entry.Index]);
+		Flush();
+
+		main.Clear();
+
+		const Statistics& stats = s_Data->Stats;
+		HZ_PROFILE_COUNTER("Renderer2D", {
+			{ "DrawCalls", stats.DrawCalls },
+			{ "Quads", stats.QuadCount },
+			{ "Vertices", stats.GetTotalVertexCount() },
+			{ "TextureSlotsUsed", stats.TextureSlotsUsed },
+			{ "QuadBufferFlushes", stats.QuadBufferFlushes },
+			{ "TextureSlotFlushes", stats.TextureSlotFlushes }
+		});
+	}
+
+	void Renderer2D::BeginSubmit(uint32_t order)
+	{
+		HZ_CORE_ASSERT(s_SubmitContext == nullptr, "BeginSubmit calls cannot be nested!");
+
+		Scope<SubmitContext> context;
+		{
+			std::lock_guard<std::mutex> lock(s_Data->ContextMutex);
+			if (!s_Data->FreeContexts.empty())
+			{
+				context = std::move(s_Data->FreeContexts.back());
+				s_Data->FreeContexts.pop_back();
+			}
+		}
+
+		if (!context)
+			context = CreateScope<SubmitContext>();
+
+		context->Order = order;
+		s_Data->ActiveContexts++;
+		s_SubmitContext = context.release();
+	}
+
+	void Renderer2D::EndSubmit()
+	{
+		HZ_CORE_ASSERT(s_SubmitContext, "EndSubmit called without BeginSubmit!");
+
+		Scope<SubmitContext> context(s_SubmitContext);
+		s_SubmitContext = nullptr;
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->ContextMutex);
+			s_Data->PendingContexts.push_back(std::move(context));
+		}
+		s_Data->ActiveContexts--;
+	}
+
+	void Renderer2D::SetMaxQuadsPerBatch(uint32_t maxQuads)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(maxQuads > 0, "A batch must hold at least one quad!");
+		HZ_CORE_ASSERT(s_Data->MainContext.QuadCommands.empty(), "Cannot resize the batch while quads are pending!");
+
+		// Vertex array setup talks to the API directly
+		if (maxQuads != s_Data->MaxQuads)
+			RenderThread::ExecuteSync([maxQuads]() { CreateQuadBuffers(maxQuads); });
+	}
+
+	uint32_t Renderer2D::GetMaxQuadsPerBatch()
+	{
+		return s_Data->MaxQuads;
+	}
+
+	void Renderer2D::SetInstancing(bool enabled)
+	{
+		HZ_CORE_ASSERT(s_Data->MainContext.QuadCommands.empty(), "Cannot switch submission path while quads are pending!");
+
+		s_Data->Instancing = enabled;
+	}
+
+	bool Renderer2D::IsInstancing()
+	{
+		return s_Data->Instancing;
+	}
+
+	void Renderer2D::SetLayer(uint8_t layer)
+	{
+		GetSubmitContext().Layer = layer;
+	}
+
+	void Renderer2D::ResetStats()
+	{
+		memset(&s_Data->Stats, 0, sizeof(Statistics));
+	}
+
+	Renderer2D::Statistics Renderer2D::GetStats()
+	{
+		return s_Data->Stats;
+	}
+
+	static const Texture2D* RetainTexture(const Ref<Texture2D>& texture)
+	{
+		SubmitContext& context = GetSubmitContext();
+		if (context.IsNewTexture(texture.get()))
+			context.Textures.push_back(texture);
+		return texture.get();
+	}
+
+	static const Texture2D* ResolveTexture(AssetHandle handle)
+	{
+		const Texture2D* texture = AssetManager::GetTexture(handle);
+		HZ_CORE_ASSERT(texture, "Invalid texture asset handle!");
+		if (!texture)
+			return s_Data->WhiteTexture.get();
+
+		// The asset may be released before EndScene
+		SubmitContext& context = GetSubmitContext();
+		if (context.IsNewTexture(texture))
+			context.Textures.push_back(AssetManager::GetTextureRef(handle));
+		return texture;
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color)
@@ -82,15 +661,7 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		s_Data->TextureShader->SetFloat4("u_Color", color);
-		s_Data->TextureShader->SetFloat("u_TilingFactor", 1.0f);
-		s_Data->WhiteTexture->Bind();
-
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-		s_Data->TextureShader->SetMat4("u_Transform", transform);
-		s_Data->QuadVertexArray->Bind();
-		RenderCommand::DrawIndexed(s_Data->QuadVertexArray);
+		QueueQuad(position, size, 0.0f, s_Data->WhiteTexture.get(), s_FullTexRect, 1.0f, color);
 	}
 
 	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
@@ -102,16 +673,34 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		s_Data->TextureShader->SetFloat4("u_Color", tintColor);
-		s_Data->TextureShader->SetFloat("u_TilingFactor", tilingFactor);
-		texture->Bind();
+		QueueQuad(position, size, 0.0f, RetainTexture(texture), s_FullTexRect, tilingFactor, tintColor);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor)
+	{
+		DrawQuad({ position.x, position.y, 0.0f }, size, subTexture, tintColor);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		const glm::vec2& min = subTexture->GetMin();
+		const glm::vec2& max = subTexture->GetMax();
+		glm::vec4 texRect = { min.x, min.y, max.x, max.y };
+		QueueQuad(position, size, 0.0f, RetainTexture(subTexture->GetTexture()), texRect, 1.0f, tintColor);
+	}
+
+	void Renderer2D::DrawQuad(const glm::vec2& position, const glm::vec2& size, AssetHandle texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		DrawQuad({ position.x, position.y, 0.0f }, size, texture, tilingFactor, tintColor);
+	}
 
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-		s_Data->TextureShader->SetMat4("u_Transform", transform);
+	void Renderer2D::DrawQuad(const glm::vec3& position, const glm::vec2& size, AssetHandle texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		HZ_PROFILE_FUNCTION();
 
-		s_Data->QuadVertexArray->Bind();
-		RenderCommand::DrawIndexed(s_Data->QuadVertexArray);
+		QueueQuad(position, size, 0.0f, ResolveTexture(texture), s_FullTexRect, tilingFactor, tintColor);
 	}
 
 	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color)
@@ -123,16 +712,7 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		s_Data->TextureShader->SetFloat4("u_Color", color);
-		s_Data->TextureShader->SetFloat("u_TilingFactor", 1.0f);
-		s_Data->WhiteTexture->Bind();
-
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::rotate(glm::mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f })
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-		s_Data->TextureShader->SetMat4("u_Transform", transform);
-		s_Data->QuadVertexArray->Bind();
-		RenderCommand::DrawIndexed(s_Data->QuadVertexArray);
+		QueueQuad(position, size, rotation, s_Data->WhiteTexture.get(), s_FullTexRect, 1.0f, color);
 	}
 
 	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor, const glm::vec4& tintColor)
@@ -144,17 +724,34 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		s_Data->TextureShader->SetFloat4("u_Color", tintColor);
-		s_Data->TextureShader->SetFloat("u_TilingFactor", tilingFactor);
-		texture->Bind();
+		QueueQuad(position, size, rotation, RetainTexture(texture), s_FullTexRect, tilingFactor, tintColor);
+	}
+
+	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor)
+	{
+		DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, subTexture, tintColor);
+	}
+
+	void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		const glm::vec2& min = subTexture->GetMin();
+		const glm::vec2& max = subTexture->GetMax();
+		glm::vec4 texRect = { min.x, min.y, max.x, max.y };
+		QueueQuad(position, size, rotation, RetainTexture(subTexture->GetTexture()), texRect, 1.0f, tintColor);
+	}
 
-		glm::mat4 transform = glm::translate(glm::mat4(1.0f), position)
-			* glm::rotate(glm::mat4(1.0f), rotation, { 0.0f, 0.0f, 1.0f })
-			* glm::scale(glm::mat4(1.0f), { size.x, size.y, 1.0f });
-		s_Data->TextureShader->SetMat4("u_Transform", transform);
+	void Renderer2D::DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, AssetHandle texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		DrawRotatedQuad({ position.x, position.y, 0.0f }, size, rotation, texture, tilingFactor, tintColor);
+	}
+
+	void Renderer2D::DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, AssetHandle texture, float tilingFactor, const glm::vec4& tintColor)
+	{
+		HZ_PROFILE_FUNCTION();
 
-		s_Data->QuadVertexArray->Bind();
-		RenderCommand::DrawIndexed(s_Data->QuadVertexArray);
+		QueueQuad(position, size, rotation, ResolveTexture(texture), s_FullTexRect, tilingFactor, tintColor);
 	}
 
-}
\ No newline at end of file
+}
@@ -2,7 +2,9 @@
 
 #include "Hazel/Renderer/OrthographicCamera.h"
 
+#include "Hazel/Renderer/AssetManager.h"
 #include "Hazel/Renderer/Texture.h"
+#include "Hazel/Renderer/SubTexture2D.h"
 
 namespace Hazel {
 
@@ -12,19 +14,71 @@ namespace Hazel {
 		static void Init();
 		static void Shutdown();
 
+		// Draws are queued and only sorted and batched at EndScene; textures passed
+		// to DrawQuad are kept alive until then
 		static void BeginScene(const OrthographicCamera& camera);
 		static void EndScene();
 
+		// Batch size is configurable; must be changed outside of BeginScene/EndScene
+		static void SetMaxQuadsPerBatch(uint32_t maxQuads);
+		static uint32_t GetMaxQuadsPerBatch();
+
+		// Instancing uploads one compact record per quad instead of four vertices;
+		// must be toggled outside of BeginScene/EndScene
+		static void SetInstancing(bool enabled);
+		static bool IsInstancing();
+
+		// Sort layer for subsequent draws on this thread; lower layers draw first.
+		// BeginScene and BeginSubmit start at layer 0
+		static void SetLayer(uint8_t layer);
+
+		// Lets a worker thread record draws while the main thread is inside BeginScene/EndScene.
+		// The calls in between go to a private context, which EndScene merges after the
+		// main-thread draws in ascending order. Orders must be unique within a scene, which
+		// keeps the result independent of thread timing. EndSubmit must happen before EndScene.
+		static void BeginSubmit(uint32_t order);
+		static void EndSubmit();
+
 		// Primitives
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const glm::vec4& color);
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const glm::vec4& color);
 		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+		// Sub-texture quads cannot tile: repeating would sample the neighbouring atlas sprites
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor = glm::vec4(1.0f));
+		// Texture asset handles resolve without touching a reference count
+		static void DrawQuad(const glm::vec2& position, const glm::vec2& size, AssetHandle texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawQuad(const glm::vec3& position, const glm::vec2& size, AssetHandle texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
 
 		static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const glm::vec4& color);
 		static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const glm::vec4& color);
 		static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
 		static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<Texture2D>& texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, const Ref<SubTexture2D>& subTexture, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawRotatedQuad(const glm::vec2& position, const glm::vec2& size, float rotation, AssetHandle texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+		static void DrawRotatedQuad(const glm::vec3& position, const glm::vec2& size, float rotation, AssetHandle texture, float tilingFactor = 1.0f, const glm::vec4& tintColor = glm::vec4(1.0f));
+
+		// Stats, accumulated since the last ResetStats. Every EndScene also records
+		// them as a "Renderer2D" counter in the profiler trace.
+		struct Statistics
+		{
+			uint32_t DrawCalls = 0;
+			uint32_t QuadCount = 0;
+			// Texture slots filled across all batches; the binds that actually reach the
+			// driver are counted by Renderer::GetStateStatistics
+			uint32_t TextureSlotsUsed = 0;
+			// Flushes forced because a batch ran out of quad space
+			uint32_t QuadBufferFlushes = 0;
+			// Flushes forced because a batch ran out of texture slots
+			uint32_t TextureSlotFlushes = 0;
+
+			uint32_t GetTotalVertexCount() const { return QuadCount * 4; }
+			uint32_t GetTotalIndexCount() const { return QuadCount * 6; }
+		};
+		static void ResetStats();
+		static Statistics GetStats();
 
 	};
 
@@ -13,13 +13,31 @@ namespace Hazel {
 		{
 			None = 0, OpenGL = 1
 		};
+
+		// State changes that reached the driver vs. ones filtered out as redundant
+		struct StateStatistics
+		{
+			uint32_t Issued = 0;
+			uint32_t Skipped = 0;
+		};
 	public:
 		virtual void Init() = 0;
 		virtual void SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height) = 0;
 		virtual void SetClearColor(const glm::vec4& color) = 0;
 		virtual void Clear() = 0;
 
-		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray) = 0;
+		// baseVertex/baseInstance offset the vertex and per-instance fetches, e.g. into a stream buffer segment
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) = 0;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) = 0;
+
+		// Number of texture units a single draw can sample from
+		virtual uint32_t GetMaxTextureSlots() const = 0;
+
+		// After the frame's last draw; lets per-frame GPU resources be recycled
+		virtual void EndFrame() = 0;
+
+		virtual StateStatistics GetStateStatistics() const = 0;
+		virtual void ResetStateStatistics() = 0;
 
 		inline static API GetAPI() { return s_API; }
 		static Scope<RendererAPI> Create();
@@ -2,20 +2,38 @@
 #include "Hazel/Renderer/Shader.h"
 
 #include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Renderer/ShaderReloader.h"
 #include "Platform/OpenGL/OpenGLShader.h"
 
 namespace Hazel {
 
-	Ref<Shader> Shader::Create(const std::string& filepath)
+	Ref<Shader> Shader::Create(const std::string& filepath, const ShaderDefines& defines)
 	{
+		Ref<Shader> shader;
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(filepath);
+			case RendererAPI::API::OpenGL:  shader = RenderThread::CreateResource<OpenGLShader>(filepath, defines); break;
+			default:                        HZ_CORE_ASSERT(false, "Unknown RendererAPI!"); return nullptr;
 		}
 
-		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
-		return nullptr;
+		RenderThread::Submit([shader]() { ShaderReloader::Watch(shader); });
+		return shader;
+	}
+
+	Ref<Shader> Shader::CreateAsync(const std::string& filepath, const ShaderDefines& defines)
+	{
+		Ref<Shader> shader;
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  shader = RenderThread::CreateResource<OpenGLShader>(filepath, defines, true); break;
+			default:                        HZ_CORE_ASSERT(false, "Unknown RendererAPI!"); return nullptr;
+		}
+
+		RenderThread::Submit([shader]() { ShaderReloader::Watch(shader); });
+		return shader;
 	}
 
 	Ref<Shader> Shader::Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
@@ -23,7 +41,7 @@ namespace Hazel {
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLShader>(name, vertexSrc, fragmentSrc);
+			case RendererAPI::API::OpenGL:  return RenderThread::CreateResource<OpenGLShader>(name, vertexSrc, fragmentSrc);
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
@@ -56,6 +74,35 @@ namespace Hazel {
 		return shader;
 	}
 
+	ShaderFuture ShaderLibrary::LoadAsync(const std::string& filepath)
+	{
+		auto shader = Shader::CreateAsync(filepath);
+		Add(shader);
+		return shader;
+	}
+
+	ShaderFuture ShaderLibrary::LoadAsync(const std::string& name, const std::string& filepath)
+	{
+		auto shader = Shader::CreateAsync(filepath);
+		Add(name, shader);
+		return shader;
+	}
+
+	Ref<Shader> ShaderLibrary::GetPermutation(const std::string& filepath, const ShaderDefines& defines)
+	{
+		std::string key = filepath;
+		for (auto& [name, value] : defines)
+			key += "|" + name + "=" + value;
+
+		auto it = m_Permutations.find(key);
+		if (it != m_Permutations.end())
+			return it->second;
+
+		auto shader = Shader::CreateAsync(filepath, defines);
+		m_Permutations[key] = shader;
+		return shader;
+	}
+
 	Ref<Shader> ShaderLibrary::Get(const std::string& name)
 	{
 		HZ_CORE_ASSERT(Exists(name), "Shader not found!");
@@ -67,4 +114,10 @@ namespace Hazel {
 		return m_Shaders.find(name) != m_Shaders.end();
 	}
 
+	void ShaderLibrary::Clear()
+	{
+		m_Shaders.clear();
+		m_Permutations.clear();
+	}
+
 }
\ No newline at end of file
@@ -1,30 +1,98 @@
 #pragma once
 
+#include <atomic>
+#include <map>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <glm/glm.hpp>
 
 namespace Hazel {
 
+	// Index into a shader's uniform table. Resolve it once with GetUniformHandle
+	// and pass it to the Set* overloads so hot paths never look up names.
+	using UniformHandle = int32_t;
+	static constexpr UniformHandle InvalidUniformHandle = -1;
+
+	// Injected as "#define Name Value" after each stage's #version line. Ordered, so
+	// equal define sets always produce the same source.
+	using ShaderDefines = std::map<std::string, std::string>;
+
 	class Shader
 	{
 	public:
 		virtual ~Shader() = default;
 
+		// Binding a shader that is still compiling waits for it to finish
 		virtual void Bind() const = 0;
 		virtual void Unbind() const = 0;
 
+		// Non-blocking; false while the driver is still compiling or linking
+		virtual bool IsReady() const = 0;
+		// Blocks until compiling and linking have finished and checks the result
+		virtual void WaitUntilReady() = 0;
+
+		// Hot reload. Reload re-reads the source file and starts building a new program
+		// next to the current one; returns false if the shader has no usable file.
+		// ApplyReload swaps the new program in once it is ready and only if it linked,
+		// keeping uniform handles and values; returns false while still compiling.
+		virtual bool Reload() = 0;
+		virtual bool ApplyReload() = 0;
+
 		virtual void SetInt(const std::string& name, int value) = 0;
+		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) = 0;
 		virtual void SetFloat(const std::string& name, float value) = 0;
 		virtual void SetFloat3(const std::string& name, const glm::vec3& value) = 0;
 		virtual void SetFloat4(const std::string& name, const glm::vec4& value) = 0;
 		virtual void SetMat4(const std::string& name, const glm::mat4& value) = 0;
 
+		virtual UniformHandle GetUniformHandle(const std::string& name) = 0;
+
+		virtual void SetInt(UniformHandle handle, int value) = 0;
+		virtual void SetIntArray(UniformHandle handle, int* values, uint32_t count) = 0;
+		virtual void SetFloat(UniformHandle handle, float value) = 0;
+		virtual void SetFloat3(UniformHandle handle, const glm::vec3& value) = 0;
+		virtual void SetFloat4(UniformHandle handle, const glm::vec4& value) = 0;
+		virtual void SetMat4(UniformHandle handle, const glm::mat4& value) = 0;
+
 		virtual const std::string& GetName() const = 0;
+		// Empty for shaders created from source strings
+		virtual const std::string& GetFilePath() const = 0;
+		// The file itself followed by everything it #includes
+		virtual const std::vector<std::string>& GetSourceFiles() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
+		// Assigned at creation and kept across hot reloads, unlike GetRendererID; safe to
+		// read on the main thread while the render thread applies a reload
+		uint32_t GetID() const { return m_ID; }
 
-		static Ref<Shader> Create(const std::string& filepath);
+		static Ref<Shader> Create(const std::string& filepath, const ShaderDefines& defines = {});
+		// Issues the compile and link without waiting for their results
+		static Ref<Shader> CreateAsync(const std::string& filepath, const ShaderDefines& defines = {});
 		static Ref<Shader> Create(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
+	private:
+		uint32_t m_ID = s_NextID++;
+
+		inline static std::atomic<uint32_t> s_NextID = 1;
+	};
+
+	// Handle to a shader that may still be compiling. The shader is usable right
+	// away; Get() (or its first Bind) waits for the driver if it has to.
+	class ShaderFuture
+	{
+	public:
+		ShaderFuture() = default;
+		ShaderFuture(const Ref<Shader>& shader)
+			: m_Shader(shader) {}
+
+		bool IsReady() const { return m_Shader && m_Shader->IsReady(); }
+		const Ref<Shader>& Get() const
+		{
+			m_Shader->WaitUntilReady();
+			return m_Shader;
+		}
+	private:
+		Ref<Shader> m_Shader;
 	};
 
 	class ShaderLibrary
@@ -34,12 +102,23 @@ namespace Hazel {
 		void Add(const Ref<Shader>& shader);
 		Ref<Shader> Load(const std::string& filepath);
 		Ref<Shader> Load(const std::string& name, const std::string& filepath);
+		// Issue every LoadAsync first and bind later, so the driver can compile them concurrently
+		ShaderFuture LoadAsync(const std::string& filepath);
+		ShaderFuture LoadAsync(const std::string& name, const std::string& filepath);
+
+		// Variant of a shader file for one set of defines. Each permutation is compiled on
+		// first request (asynchronously, like LoadAsync) and shared by later callers.
+		Ref<Shader> GetPermutation(const std::string& filepath, const ShaderDefines& defines = {});
 
 		Ref<Shader> Get(const std::string& name);
 
 		bool Exists(const std::string& name) const;
+
+		void Clear();
 	private:
 		std::unordered_map<std::string, Ref<Shader>> m_Shaders;
+		// Keyed by file path and define set, see GetPermutation
+		std::unordered_map<std::string, Ref<Shader>> m_Permutations;
 	};
 
 }
\ No newline at end of file
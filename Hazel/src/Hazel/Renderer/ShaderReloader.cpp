@@ -0,0 +1,95 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/ShaderReloader.h"
+
+#include "Hazel/Core/FileWatcher.h"
+
+namespace Hazel {
+
+	struct ShaderReloaderData
+	{
+		Scope<FileWatcher> Watcher;
+
+		// Weak so that watching a shader doesn't keep it alive
+		std::unordered_map<std::string, std::vector<std::weak_ptr<Shader>>> Shaders;
+		std::vector<std::weak_ptr<Shader>> Pending;
+	};
+
+	static Scope<ShaderReloaderData> s_Data;
+
+	void ShaderReloader::Init()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		s_Data = CreateScope<ShaderReloaderData>();
+		s_Data->Watcher = FileWatcher::Create();
+	}
+
+	void ShaderReloader::Shutdown()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		s_Data.reset();
+	}
+
+	void ShaderReloader::Watch(const Ref<Shader>& shader)
+	{
+		if (!s_Data || !shader)
+			return;
+
+		// Editing an included file rebuilds every shader that pulls it in
+		for (const auto& filepath : shader->GetSourceFiles())
+		{
+			auto& shaders = s_Data->Shaders[filepath];
+			if (shaders.empty())
+				s_Data->Watcher->Watch(filepath);
+			shaders.push_back(shader);
+		}
+	}
+
+	void ShaderReloader::Update()
+	{
+		if (!s_Data)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		std::unordered_set<Shader*> reloaded;
+		for (const auto& filepath : s_Data->Watcher->Poll())
+		{
+			auto it = s_Data->Shaders.find(filepath);
+			if (it == s_Data->Shaders.end())
+				continue;
+
+			auto& shaders = it->second;
+			shaders.erase(std::remove_if(shaders.begin(), shaders.end(),
+				[](const std::weak_ptr<Shader>& shader) { return shader.expired(); }), shaders.end());
+
+			if (shaders.empty())
+			{
+				s_Data->Watcher->Unwatch(filepath);
+				s_Data->Shaders.erase(it);
+				continue;
+			}
+
+			HZ_CORE_INFO("Shader source '{0}' changed, reloading", filepath);
+			for (auto& weakShader : shaders)
+			{
+				Ref<Shader> shader = weakShader.lock();
+				if (!reloaded.insert(shader.get()).second)
+					continue; // Several of its files changed at once
+
+				if (shader->Reload())
+					s_Data->Pending.push_back(shader);
+			}
+		}
+
+		// The driver compiles in the background; pick up whatever has finished
+		auto& pending = s_Data->Pending;
+		pending.erase(std::remove_if(pending.begin(), pending.end(), [](const std::weak_ptr<Shader>& weakShader)
+		{
+			Ref<Shader> shader = weakShader.lock();
+			return !shader || shader->ApplyReload();
+		}), pending.end());
+	}
+
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "Hazel/Renderer/Shader.h"
+
+namespace Hazel {
+
+	// Watches the source files of shaders created from disk and rebuilds them when they
+	// change. The new program is only swapped into the existing Shader once it linked,
+	// so a broken edit leaves the previous version running.
+	class ShaderReloader
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		// Does nothing when hot reload is disabled or the shader has no file
+		static void Watch(const Ref<Shader>& shader);
+
+		// Call at a frame boundary, while no draws are being recorded
+		static void Update();
+	};
+
+}
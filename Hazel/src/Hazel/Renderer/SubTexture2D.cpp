@@ -0,0 +1,29 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/SubTexture2D.h"
+
+namespace Hazel {
+
+	SubTexture2D::SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max)
+		: m_Texture(texture), m_Min(min), m_Max(max)
+	{
+	}
+
+	uint32_t SubTexture2D::GetWidth() const
+	{
+		return (uint32_t)((m_Max.x - m_Min.x) * m_Texture->GetWidth() + 0.5f);
+	}
+
+	uint32_t SubTexture2D::GetHeight() const
+	{
+		return (uint32_t)((m_Max.y - m_Min.y) * m_Texture->GetHeight() + 0.5f);
+	}
+
+	Ref<SubTexture2D> SubTexture2D::CreateFromCoords(const Ref<Texture2D>& texture, const glm::vec2& coords, const glm::vec2& cellSize, const glm::vec2& spriteSize)
+	{
+		glm::vec2 textureSize = { (float)texture->GetWidth(), (float)texture->GetHeight() };
+		glm::vec2 min = coords * cellSize / textureSize;
+		glm::vec2 max = (coords + spriteSize) * cellSize / textureSize;
+		return CreateRef<SubTexture2D>(texture, min, max);
+	}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+#include <glm/glm.hpp>
+
+namespace Hazel {
+
+	// A rectangle of a texture, e.g. one sprite of an atlas page. Quads drawn from
+	// sub-textures of the same page share its texture slot and so batch together.
+	class SubTexture2D
+	{
+	public:
+		SubTexture2D(const Ref<Texture2D>& texture, const glm::vec2& min, const glm::vec2& max);
+
+		const Ref<Texture2D>& GetTexture() const { return m_Texture; }
+
+		// Normalized texture coordinates, min at the bottom left
+		const glm::vec2& GetMin() const { return m_Min; }
+		const glm::vec2& GetMax() const { return m_Max; }
+
+		// Size in texels
+		uint32_t GetWidth() const;
+		uint32_t GetHeight() const;
+
+		// Cell (x, y) of a grid of cellSize texels, spanning spriteSize cells
+		static Ref<SubTexture2D> CreateFromCoords(const Ref<Texture2D>& texture, const glm::vec2& coords, const glm::vec2& cellSize, const glm::vec2& spriteSize = { 1.0f, 1.0f });
+	private:
+		Ref<Texture2D> m_Texture;
+		glm::vec2 m_Min;
+		glm::vec2 m_Max;
+	};
+
+}
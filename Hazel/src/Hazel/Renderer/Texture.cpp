@@ -2,32 +2,54 @@
 #include "Hazel/Renderer/Texture.h"
 
 #include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Renderer/TextureLoader.h"
+#include "Hazel/Renderer/TextureResidency.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
 
 namespace Hazel {
 
 	Ref<Texture2D> Texture2D::Create(uint32_t width, uint32_t height)
 	{
+		Ref<Texture2D> texture;
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(width, height);
+			case RendererAPI::API::OpenGL:  texture = RenderThread::CreateResource<OpenGLTexture2D>(width, height); break;
+			default:                        HZ_CORE_ASSERT(false, "Unknown RendererAPI!"); return nullptr;
 		}
 
-		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
-		return nullptr;
+		RenderThread::Submit([texture]() { TextureResidency::Register(texture); });
+		return texture;
 	}
 
 	Ref<Texture2D> Texture2D::Create(const std::string& path)
 	{
+		Ref<Texture2D> texture;
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLTexture2D>(path);
+			case RendererAPI::API::OpenGL:  texture = RenderThread::CreateResource<OpenGLTexture2D>(path); break;
+			default:                        HZ_CORE_ASSERT(false, "Unknown RendererAPI!"); return nullptr;
 		}
 
-		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
-		return nullptr;
+		RenderThread::Submit([texture]() { TextureResidency::Register(texture); });
+		return texture;
+	}
+
+	Ref<Texture2D> Texture2D::CreateAsync(const std::string& path)
+	{
+		Ref<Texture2D> texture;
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  texture = RenderThread::CreateResource<OpenGLTexture2D>(path, true); break;
+			default:                        HZ_CORE_ASSERT(false, "Unknown RendererAPI!"); return nullptr;
+		}
+
+		RenderThread::Submit([texture]() { TextureResidency::Register(texture); });
+		TextureLoader::Load(texture, path);
+		return texture;
 	}
 
 }
\ No newline at end of file
@@ -1,11 +1,61 @@
 #pragma once
 
+#include <atomic>
 #include <string>
 
 #include "Hazel/Core/Core.h"
 
 namespace Hazel {
 
+	enum class TextureFormat : uint32_t
+	{
+		None = 0,
+		RGB8, RGBA8,
+		// Block compressed, 4x4 texels per block: BC1 for opaque images, BC3 with alpha
+		BC1, BC3
+	};
+
+	inline bool IsCompressedFormat(TextureFormat format)
+	{
+		return format == TextureFormat::BC1 || format == TextureFormat::BC3;
+	}
+
+	// Texel rows per row of data: 4 for block compressed formats, otherwise 1
+	inline uint32_t GetFormatBlockHeight(TextureFormat format)
+	{
+		return IsCompressedFormat(format) ? 4 : 1;
+	}
+
+	// Bytes in one row of data (of texels, or of blocks for compressed formats)
+	inline uint32_t GetFormatRowPitch(TextureFormat format, uint32_t width)
+	{
+		switch (format)
+		{
+			case TextureFormat::RGB8:  return width * 3;
+			case TextureFormat::RGBA8: return width * 4;
+			case TextureFormat::BC1:   return (width + 3) / 4 * 8;
+			case TextureFormat::BC3:   return (width + 3) / 4 * 16;
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown texture format!");
+		return 0;
+	}
+
+	// One mip level of image data owned by someone else, bottom row first
+	struct TextureLevel
+	{
+		uint32_t Width = 0, Height = 0;
+		const uint8_t* Data = nullptr;
+		uint64_t Size = 0;
+	};
+
+	// Texel rectangle of a texture's base level; X and Y count from the bottom left
+	struct TextureRegion
+	{
+		uint32_t X = 0, Y = 0;
+		uint32_t Width = 0, Height = 0;
+	};
+
 	class Texture
 	{
 	public:
@@ -13,17 +63,61 @@ namespace Hazel {
 
 		virtual uint32_t GetWidth() const = 0;
 		virtual uint32_t GetHeight() const = 0;
+		virtual uint32_t GetRendererID() const = 0;
+		// Assigned at creation and never changes, unlike GetRendererID, which moves to a new
+		// texture object when an asynchronous load or an eviction completes. Safe to read on
+		// the main thread while the render thread runs, which is what sort keys need.
+		uint32_t GetID() const { return m_ID; }
+
+		// Whether the texture can contain non-opaque texels, which forces blended drawing.
+		// Fixed at creation; asynchronously loaded textures take it from the file header.
+		virtual bool HasAlpha() const = 0;
+
+		// False while an asynchronously created texture still shows its placeholder
+		virtual bool IsLoaded() const = 0;
+
+		// GPU memory currently held, and what the complete image takes once loaded
+		virtual uint64_t GetMemorySize() const = 0;
+		virtual uint64_t GetFullMemorySize() const = 0;
+		// TextureResidency frame in which the texture was last bound
+		virtual uint64_t GetLastBindFrame() const = 0;
 
 		virtual void SetData(void* data, uint32_t size) = 0;
+		// Writes part of the base level. pitch is the number of bytes between the starts of
+		// consecutive rows in data, or 0 when the rows are tightly packed.
+		virtual void SetData(const TextureRegion& region, const void* data, uint32_t pitch = 0) = 0;
+
+		// For textures rewritten every frame: SetData copies into a ring of staging buffers
+		// and returns without waiting for the GPU, unless it is a full ring behind. Costs
+		// three copies of the base level in staging memory.
+		virtual void SetStreaming(bool enabled) = 0;
+		virtual bool IsStreaming() const = 0;
 
 		virtual void Bind(uint32_t slot = 0) const = 0;
+	private:
+		uint32_t m_ID = s_NextID++;
+
+		inline static std::atomic<uint32_t> s_NextID = 1;
 	};
 
 	class Texture2D : public Texture
 	{
 	public:
+		// Empty for textures not loaded from a file
+		virtual const std::string& GetPath() const = 0;
+
+		// Used by TextureResidency. Evict frees most of the texture's memory by dropping its
+		// top mip levels, or the whole image when it has none, until it is reloaded from its
+		// file; the size reported by GetWidth/GetHeight is kept. Returns false for textures
+		// that cannot be reloaded or are already evicted or loading.
+		virtual bool Evict() = 0;
+		virtual bool IsEvicted() const = 0;
+
 		static Ref<Texture2D> Create(uint32_t width, uint32_t height);
 		static Ref<Texture2D> Create(const std::string& path);
+		// Returns at once with a 1x1 placeholder that is replaced, size included, once the
+		// image has been decoded and uploaded in the background (see TextureLoader)
+		static Ref<Texture2D> CreateAsync(const std::string& path);
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,219 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/TextureAtlas.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <stb_image.h>
+
+namespace Hazel {
+
+	TextureAtlas::TextureAtlas(uint32_t pageSize, uint32_t padding)
+		: m_PageSize(pageSize), m_Padding(padding)
+	{
+	}
+
+	Ref<SubTexture2D> TextureAtlas::Add(const std::string& path)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		int width, height, channels;
+		stbi_set_flip_vertically_on_load(1);
+		stbi_uc* data = nullptr;
+		{
+			HZ_PROFILE_SCOPE("stbi_load - TextureAtlas::Add(const std::string&)");
+			data = stbi_load(path.c_str(), &width, &height, &channels, 4);
+		}
+
+		if (!data)
+		{
+			HZ_CORE_ERROR("Failed to load image '{0}'", path);
+			return nullptr;
+		}
+
+		Ref<SubTexture2D> subTexture = Add(data, width, height);
+		stbi_image_free(data);
+		return subTexture;
+	}
+
+	Ref<SubTexture2D> TextureAtlas::Add(const void* pixels, uint32_t width, uint32_t height)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		uint32_t paddedWidth = width + 2 * m_Padding;
+		uint32_t paddedHeight = height + 2 * m_Padding;
+		if (paddedWidth > m_PageSize || paddedHeight > m_PageSize)
+		{
+			HZ_CORE_ERROR("{0}x{1} image does not fit in a {2}x{2} atlas page", width, height, m_PageSize);
+			return nullptr;
+		}
+
+		Page* page = nullptr;
+		uint32_t x = 0, y = 0;
+		size_t node = 0;
+		for (auto& candidate : m_Pages)
+		{
+			if (FindPosition(candidate, paddedWidth, paddedHeight, x, y, node))
+			{
+				page = &candidate;
+				break;
+			}
+		}
+
+		if (!page)
+		{
+			page = &CreatePage();
+			bool found = FindPosition(*page, paddedWidth, paddedHeight, x, y, node);
+			HZ_CORE_ASSERT(found, "An empty page must fit the image!");
+		}
+
+		Place(*page, node, x, y, paddedWidth, paddedHeight);
+
+		// Copy the image, clamping source coordinates so the padding repeats its edge texels
+		const uint8_t* source = (const uint8_t*)pixels;
+		for (uint32_t row = 0; row < paddedHeight; row++)
+		{
+			uint32_t sourceRow = (uint32_t)std::clamp((int32_t)row - (int32_t)m_Padding, 0, (int32_t)height - 1);
+			uint8_t* destination = page->Pixels.data() + ((size_t)(y + row) * m_PageSize + x) * 4;
+			const uint8_t* sourceLine = source + (size_t)sourceRow * width * 4;
+
+			for (uint32_t column = 0; column < m_Padding; column++)
+				memcpy(destination + column * 4, sourceLine, 4);
+			memcpy(destination + m_Padding * 4, sourceLine, (size_t)width * 4);
+			for (uint32_t column = m_Padding + width; column < paddedWidth; column++)
+				memcpy(destination + column * 4, sourceLine + (width - 1) * 4, 4);
+		}
+
+		TextureRegion& dirty = page->Dirty;
+		if (dirty.Width == 0)
+		{
+			dirty = { x, y, paddedWidth, paddedHeight };
+		}
+		else
+		{
+			uint32_t right = std::max(dirty.X + dirty.Width, x + paddedWidth);
+			uint32_t top = std::max(dirty.Y + dirty.Height, y + paddedHeight);
+			dirty.X = std::min(dirty.X, x);
+			dirty.Y = std::min(dirty.Y, y);
+			dirty.Width = right - dirty.X;
+			dirty.Height = top - dirty.Y;
+		}
+
+		float pageSize = (float)m_PageSize;
+		glm::vec2 min = { (x + m_Padding) / pageSize, (y + m_Padding) / pageSize };
+		glm::vec2 max = { (x + m_Padding + width) / pageSize, (y + m_Padding + height) / pageSize };
+		return CreateRef<SubTexture2D>(page->Texture, min, max);
+	}
+
+	void TextureAtlas::Commit()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		for (auto& page : m_Pages)
+		{
+			const TextureRegion& dirty = page.Dirty;
+			if (dirty.Width == 0)
+				continue;
+
+			const uint8_t* data = page.Pixels.data() + ((size_t)dirty.Y * m_PageSize + dirty.X) * 4;
+			uint32_t pitch = m_PageSize * 4;
+			if (RenderThread::IsRecording())
+			{
+				// The pixels can be written again before the render thread gets to the upload
+				uint32_t size = (dirty.Height - 1) * pitch + dirty.Width * 4;
+				const void* copy = RenderThread::AllocateFrameData(data, size);
+				RenderThread::Submit([texture = page.Texture.get(), region = dirty, copy, pitch]() { texture->SetData(region, copy, pitch); });
+			}
+			else
+			{
+				page.Texture->SetData(dirty, data, pitch);
+			}
+			page.Dirty = {};
+		}
+	}
+
+	// Lowest spot where a width x height rectangle rests on the skyline starting at
+	// one of its nodes; ties go to the narrower node to leave less wasted space
+	bool TextureAtlas::FindPosition(const Page& page, uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY, size_t& outNode) const
+	{
+		const auto& skyline = page.Skyline;
+
+		uint32_t bestY = UINT32_MAX, bestWidth = UINT32_MAX;
+		for (size_t i = 0; i < skyline.size(); i++)
+		{
+			uint32_t x = skyline[i].X;
+			if (x + width > m_PageSize)
+				break;
+
+			// The rectangle rests on the highest node it spans
+			uint32_t y = 0;
+			uint32_t remaining = width;
+			for (size_t j = i; remaining > 0; j++)
+			{
+				y = std::max(y, skyline[j].Y);
+				remaining -= std::min(remaining, skyline[j].Width);
+			}
+
+			if (y + height > m_PageSize)
+				continue;
+
+			if (y < bestY || (y == bestY && skyline[i].Width < bestWidth))
+			{
+				bestY = y;
+				bestWidth = skyline[i].Width;
+				outX = x;
+				outY = y;
+				outNode = i;
+			}
+		}
+
+		return bestY != UINT32_MAX;
+	}
+
+	void TextureAtlas::Place(Page& page, size_t node, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+	{
+		auto& skyline = page.Skyline;
+		skyline.insert(skyline.begin() + node, { x, y + height, width });
+
+		// Trim or drop the nodes now covered by the new one
+		for (size_t i = node + 1; i < skyline.size(); i++)
+		{
+			uint32_t right = x + width;
+			if (skyline[i].X >= right)
+				break;
+
+			uint32_t overlap = right - skyline[i].X;
+			if (overlap < skyline[i].Width)
+			{
+				skyline[i].X += overlap;
+				skyline[i].Width -= overlap;
+				break;
+			}
+
+			skyline.erase(skyline.begin() + i);
+			i--;
+		}
+
+		// Merge neighbours of equal height
+		for (size_t i = 0; i + 1 < skyline.size(); i++)
+		{
+			if (skyline[i].Y == skyline[i + 1].Y)
+			{
+				skyline[i].Width += skyline[i + 1].Width;
+				skyline.erase(skyline.begin() + i + 1);
+				i--;
+			}
+		}
+	}
+
+	TextureAtlas::Page& TextureAtlas::CreatePage()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		Page& page = m_Pages.emplace_back();
+		page.Texture = Texture2D::Create(m_PageSize, m_PageSize);
+		page.Pixels.resize((size_t)m_PageSize * m_PageSize * 4, 0);
+		page.Skyline.push_back({ 0, 0, m_PageSize });
+		return page;
+	}
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "Hazel/Renderer/SubTexture2D.h"
+
+namespace Hazel {
+
+	// Packs many small images into a few large RGBA pages at runtime so sprites drawn
+	// from them share texture slots. Placement uses a bottom-left skyline; each image
+	// is surrounded by `padding` texels repeating its edge, which keeps linear
+	// filtering from bleeding neighbours in.
+	//
+	// Pages are assembled in memory; Commit() uploads the parts that changed. The
+	// returned sub-textures are valid straight away but show stale texels until then.
+	class TextureAtlas
+	{
+	public:
+		TextureAtlas(uint32_t pageSize = 2048, uint32_t padding = 2);
+
+		// Returns nullptr if the image cannot be loaded or is larger than a page
+		Ref<SubTexture2D> Add(const std::string& path);
+		// Tightly packed 8-bit RGBA rows, bottom row first
+		Ref<SubTexture2D> Add(const void* pixels, uint32_t width, uint32_t height);
+
+		void Commit();
+
+		uint32_t GetPageCount() const { return (uint32_t)m_Pages.size(); }
+		const Ref<Texture2D>& GetPage(uint32_t index) const { return m_Pages[index].Texture; }
+	private:
+		struct SkylineNode
+		{
+			uint32_t X, Y, Width;
+		};
+
+		struct Page
+		{
+			Ref<Texture2D> Texture;
+			std::vector<uint8_t> Pixels;
+			std::vector<SkylineNode> Skyline;
+			// Written since the last Commit; empty when clean
+			TextureRegion Dirty;
+		};
+
+		bool FindPosition(const Page& page, uint32_t width, uint32_t height, uint32_t& outX, uint32_t& outY, size_t& outNode) const;
+		void Place(Page& page, size_t node, uint32_t x, uint32_t y, uint32_t width, uint32_t height);
+		Page& CreatePage();
+	private:
+		uint32_t m_PageSize;
+		uint32_t m_Padding;
+		std::vector<Page> m_Pages;
+	};
+
+}
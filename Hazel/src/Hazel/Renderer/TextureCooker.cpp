@@ -0,0 +1,373 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/TextureCooker.h"
+
+#include "Hazel/Core/JobSystem.h"
+
+#include <stb_image.h>
+
+#include <climits>
+#include <filesystem>
+#include <fstream>
+
+namespace Hazel {
+
+	static constexpr uint32_t CookedTextureMagic = 0x58545a48; // "HZTX"
+	static constexpr uint32_t CookedTextureVersion = 1;
+	static constexpr uint64_t CookedTextureAlignment = 16;
+
+	struct CookedTextureHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t Width;
+		uint32_t Height;
+		TextureFormat Format;
+		uint32_t LevelCount;
+	};
+
+	// Followed by LevelCount of these; offsets are from the start of the file
+	struct CookedTextureLevel
+	{
+		uint32_t Width;
+		uint32_t Height;
+		uint64_t Offset;
+		uint64_t Size;
+	};
+
+	struct Image
+	{
+		uint32_t Width, Height, Channels;
+		std::vector<uint8_t> Pixels;
+	};
+
+	// 2x2 box filter; odd edges reuse their last texel
+	static Image Downsample(const Image& source)
+	{
+		Image result;
+		result.Width = std::max(source.Width / 2, 1u);
+		result.Height = std::max(source.Height / 2, 1u);
+		result.Channels = source.Channels;
+		result.Pixels.resize((size_t)result.Width * result.Height * result.Channels);
+
+		for (uint32_t y = 0; y < result.Height; y++)
+		{
+			uint32_t y0 = std::min(y * 2, source.Height - 1), y1 = std::min(y * 2 + 1, source.Height - 1);
+			for (uint32_t x = 0; x < result.Width; x++)
+			{
+				uint32_t x0 = std::min(x * 2, source.Width - 1), x1 = std::min(x * 2 + 1, source.Width - 1);
+				for (uint32_t c = 0; c < source.Channels; c++)
+				{
+					auto texel = [&](uint32_t tx, uint32_t ty) { return (uint32_t)source.Pixels[((size_t)ty * source.Width + tx) * source.Channels + c]; };
+					uint32_t sum = texel(x0, y0) + texel(x1, y0) + texel(x0, y1) + texel(x1, y1);
+					result.Pixels[((size_t)y * result.Width + x) * result.Channels + c] = (uint8_t)((sum + 2) / 4);
+				}
+			}
+		}
+
+		return result;
+	}
+
+	static uint16_t PackRGB565(const uint8_t* color)
+	{
+		return (uint16_t)(((color[0] * 31 + 127) / 255) << 11 | ((color[1] * 63 + 127) / 255) << 5 | ((color[2] * 31 + 127) / 255));
+	}
+
+	static void UnpackRGB565(uint16_t packed, int* color)
+	{
+		color[0] = ((packed >> 11) & 31) * 255 / 31;
+		color[1] = ((packed >> 5) & 63) * 255 / 63;
+		color[2] = (packed & 31) * 255 / 31;
+	}
+
+	// Endpoints are the corners of the block's color bounding box, indices pick the
+	// nearest of the four palette entries. Always uses the four color mode.
+	static void EncodeColorBlock(const uint8_t block[16][4], uint8_t* output)
+	{
+		uint8_t min[3] = { 255, 255, 255 }, max[3] = { 0, 0, 0 };
+		for (int i = 0; i < 16; i++)
+		{
+			for (int c = 0; c < 3; c++)
+			{
+				min[c] = std::min(min[c], block[i][c]);
+				max[c] = std::max(max[c], block[i][c]);
+			}
+		}
+
+		uint16_t color0 = PackRGB565(max), color1 = PackRGB565(min);
+		uint32_t indices = 0;
+		if (color0 < color1)
+			std::swap(color0, color1);
+
+		if (color0 != color1)
+		{
+			int palette[4][3];
+			UnpackRGB565(color0, palette[0]);
+			UnpackRGB565(color1, palette[1]);
+			for (int c = 0; c < 3; c++)
+			{
+				palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+				palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+			}
+
+			for (int i = 0; i < 16; i++)
+			{
+				int bestIndex = 0, bestError = INT_MAX;
+				for (int p = 0; p < 4; p++)
+				{
+					int error = 0;
+					for (int c = 0; c < 3; c++)
+						error += (block[i][c] - palette[p][c]) * (block[i][c] - palette[p][c]);
+					if (error < bestError)
+					{
+						bestError = error;
+						bestIndex = p;
+					}
+				}
+				indices |= (uint32_t)bestIndex << (i * 2);
+			}
+		}
+
+		memcpy(output + 0, &color0, 2);
+		memcpy(output + 2, &color1, 2);
+		memcpy(output + 4, &indices, 4);
+	}
+
+	// Eight-value mode between the block's alpha extremes
+	static void EncodeAlphaBlock(const uint8_t block[16][4], uint8_t* output)
+	{
+		uint8_t alpha0 = 0, alpha1 = 255;
+		for (int i = 0; i < 16; i++)
+		{
+			alpha0 = std::max(alpha0, block[i][3]);
+			alpha1 = std::min(alpha1, block[i][3]);
+		}
+
+		uint64_t indices = 0;
+		if (alpha0 != alpha1)
+		{
+			int palette[8] = { alpha0, alpha1 };
+			for (int p = 2; p < 8; p++)
+				palette[p] = ((8 - p) * alpha0 + (p - 1) * alpha1) / 7;
+
+			for (int i = 0; i < 16; i++)
+			{
+				int bestIndex = 0, bestError = INT_MAX;
+				for (int p = 0; p < 8; p++)
+				{
+					int error = std::abs(block[i][3] - palette[p]);
+					if (error < bestError)
+					{
+						bestError = error;
+						bestIndex = p;
+					}
+				}
+				indices |= (uint64_t)bestIndex << (i * 3);
+			}
+		}
+
+		output[0] = alpha0;
+		output[1] = alpha1;
+		for (int i = 0; i < 6; i++)
+			output[2 + i] = (uint8_t)(indices >> (i * 8));
+	}
+
+	static std::vector<uint8_t> Compress(const Image& image, TextureFormat format)
+	{
+		uint32_t blocksWide = (image.Width + 3) / 4, blocksHigh = (image.Height + 3) / 4;
+		uint32_t blockSize = format == TextureFormat::BC1 ? 8 : 16;
+		std::vector<uint8_t> result((size_t)blocksWide * blocksHigh * blockSize);
+
+		// Rows of blocks are independent, so they are encoded in parallel
+		JobSystem::ParallelFor(blocksHigh, 8, [&](uint32_t begin, uint32_t end)
+		{
+			uint8_t* output = result.data() + (size_t)begin * blocksWide * blockSize;
+			for (uint32_t by = begin; by < end; by++)
+			{
+				for (uint32_t bx = 0; bx < blocksWide; bx++)
+				{
+					// Blocks past the edge repeat the last row and column
+					uint8_t block[16][4];
+					for (uint32_t i = 0; i < 16; i++)
+					{
+						uint32_t x = std::min(bx * 4 + i % 4, image.Width - 1);
+						uint32_t y = std::min(by * 4 + i / 4, image.Height - 1);
+						const uint8_t* texel = &image.Pixels[((size_t)y * image.Width + x) * image.Channels];
+						block[i][0] = texel[0];
+						block[i][1] = texel[1];
+						block[i][2] = texel[2];
+						block[i][3] = image.Channels == 4 ? texel[3] : 255;
+					}
+
+					if (format == TextureFormat::BC3)
+					{
+						EncodeAlphaBlock(block, output);
+						output += 8;
+					}
+					EncodeColorBlock(block, output);
+					output += 8;
+				}
+			}
+		});
+
+		return result;
+	}
+
+	bool TextureCooker::Cook(const std::string& sourcePath, const std::string& cookedPath, const TextureCookSettings& settings)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		int width, height, channels;
+		stbi_set_flip_vertically_on_load(1);
+		stbi_uc* data = stbi_load(sourcePath.c_str(), &width, &height, &channels, 0);
+		if (!data)
+		{
+			HZ_CORE_ERROR("Failed to load image '{0}'", sourcePath);
+			return false;
+		}
+
+		// Grey and grey-alpha images are widened so the GPU formats stay RGB(A)
+		uint32_t cookedChannels = channels == 2 || channels == 4 ? 4 : 3;
+		Image image = { (uint32_t)width, (uint32_t)height, cookedChannels };
+		image.Pixels.resize((size_t)width * height * cookedChannels);
+		for (size_t i = 0; i < (size_t)width * height; i++)
+		{
+			const stbi_uc* source = data + i * channels;
+			uint8_t* destination = &image.Pixels[i * cookedChannels];
+			bool grey = channels <= 2;
+			destination[0] = source[0];
+			destination[1] = grey ? source[0] : source[1];
+			destination[2] = grey ? source[0] : source[2];
+			if (cookedChannels == 4)
+				destination[3] = source[channels - 1];
+		}
+		stbi_image_free(data);
+
+		TextureFormat format = cookedChannels == 4 ? TextureFormat::RGBA8 : TextureFormat::RGB8;
+		if (settings.Compress)
+			format = cookedChannels == 4 ? TextureFormat::BC3 : TextureFormat::BC1;
+
+		std::vector<Image> mips;
+		mips.push_back(std::move(image));
+		while (settings.GenerateMips && (mips.back().Width > 1 || mips.back().Height > 1))
+			mips.push_back(Downsample(mips.back()));
+
+		std::vector<std::vector<uint8_t>> payloads;
+		for (auto& mip : mips)
+			payloads.push_back(IsCompressedFormat(format) ? Compress(mip, format) : std::move(mip.Pixels));
+
+		CookedTextureHeader header = { CookedTextureMagic, CookedTextureVersion, (uint32_t)width, (uint32_t)height, format, (uint32_t)mips.size() };
+
+		std::vector<CookedTextureLevel> levels;
+		uint64_t offset = sizeof(CookedTextureHeader) + sizeof(CookedTextureLevel) * mips.size();
+		for (size_t i = 0; i < mips.size(); i++)
+		{
+			offset = (offset + CookedTextureAlignment - 1) & ~(CookedTextureAlignment - 1);
+			levels.push_back({ mips[i].Width, mips[i].Height, offset, payloads[i].size() });
+			offset += payloads[i].size();
+		}
+
+		std::filesystem::path path(cookedPath);
+		std::error_code error;
+		if (path.has_parent_path())
+			std::filesystem::create_directories(path.parent_path(), error);
+
+		// Written next to the target and renamed over it, so a crash or a full disk never
+		// leaves a truncated file that looks newer than its source
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp";
+		{
+			std::ofstream out(tempPath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+			if (out)
+			{
+				out.write((const char*)&header, sizeof(header));
+				out.write((const char*)levels.data(), sizeof(CookedTextureLevel) * levels.size());
+				for (size_t i = 0; i < levels.size(); i++)
+				{
+					static const char padding[CookedTextureAlignment] = {};
+					out.write(padding, levels[i].Offset - (uint64_t)out.tellp());
+					out.write((const char*)payloads[i].data(), payloads[i].size());
+				}
+				out.close();
+			}
+
+			if (!out)
+			{
+				HZ_CORE_ERROR("Could not write cooked texture '{0}'", cookedPath);
+				std::filesystem::remove(tempPath, error);
+				return false;
+			}
+		}
+
+		std::filesystem::rename(tempPath, path, error);
+		if (error)
+		{
+			HZ_CORE_ERROR("Could not write cooked texture '{0}': {1}", cookedPath, error.message());
+			std::filesystem::remove(tempPath, error);
+			return false;
+		}
+
+		HZ_CORE_INFO("Cooked '{0}' -> '{1}' ({2} levels)", sourcePath, cookedPath, levels.size());
+		return true;
+	}
+
+	bool TextureCooker::CookIfStale(const std::string& sourcePath, const std::string& cookedPath, const TextureCookSettings& settings)
+	{
+		std::error_code error;
+		auto sourceTime = std::filesystem::last_write_time(sourcePath, error);
+		if (error)
+			return std::filesystem::exists(cookedPath); // Shipped without sources
+
+		auto cookedTime = std::filesystem::last_write_time(cookedPath, error);
+		if (!error && cookedTime >= sourceTime)
+			return true;
+
+		return Cook(sourcePath, cookedPath, settings);
+	}
+
+	bool TextureCooker::Read(const uint8_t* data, uint64_t size, CookedTexture& texture)
+	{
+		if (size < sizeof(CookedTextureHeader))
+			return false;
+
+		CookedTextureHeader header;
+		memcpy(&header, data, sizeof(header));
+		bool knownFormat = header.Format >= TextureFormat::RGB8 && header.Format <= TextureFormat::BC3;
+		if (header.Magic != CookedTextureMagic || header.Version != CookedTextureVersion || !knownFormat || header.LevelCount == 0)
+		{
+			HZ_CORE_ERROR("Not a cooked texture, or cooked by another version");
+			return false;
+		}
+
+		uint64_t tableEnd = sizeof(CookedTextureHeader) + sizeof(CookedTextureLevel) * (uint64_t)header.LevelCount;
+		if (size < tableEnd)
+			return false;
+
+		texture.Width = header.Width;
+		texture.Height = header.Height;
+		texture.Format = header.Format;
+		texture.Levels.clear();
+
+		for (uint32_t i = 0; i < header.LevelCount; i++)
+		{
+			CookedTextureLevel level;
+			memcpy(&level, data + sizeof(CookedTextureHeader) + sizeof(CookedTextureLevel) * i, sizeof(level));
+
+			uint64_t expectedSize = (uint64_t)GetFormatRowPitch(header.Format, level.Width) * ((level.Height + GetFormatBlockHeight(header.Format) - 1) / GetFormatBlockHeight(header.Format));
+			if (level.Offset < tableEnd || level.Offset + level.Size > size || level.Size != expectedSize)
+			{
+				HZ_CORE_ERROR("Cooked texture is truncated or corrupt");
+				return false;
+			}
+
+			texture.Levels.push_back({ level.Width, level.Height, data + level.Offset, level.Size });
+		}
+
+		return true;
+	}
+
+	bool TextureCooker::IsCookedPath(const std::string& path)
+	{
+		return std::filesystem::path(path).extension() == ".hztex";
+	}
+
+}
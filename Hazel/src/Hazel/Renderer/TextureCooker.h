@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+#include <vector>
+
+namespace Hazel {
+
+	struct TextureCookSettings
+	{
+		bool GenerateMips = true;
+		// BC1 for opaque images, BC3 for images with alpha. Needs S3TC support at load time.
+		bool Compress = false;
+	};
+
+	// A parsed .hztex; the levels point into the memory it was read from
+	struct CookedTexture
+	{
+		uint32_t Width = 0, Height = 0;
+		TextureFormat Format = TextureFormat::None;
+		std::vector<TextureLevel> Levels;
+	};
+
+	// Converts images into .hztex containers: a small header and level table followed by
+	// the final GPU data of every mip level, already flipped to bottom row first. Loading
+	// one is a file mapping and one upload per level, with no decoding.
+	class TextureCooker
+	{
+	public:
+		static bool Cook(const std::string& sourcePath, const std::string& cookedPath, const TextureCookSettings& settings = {});
+		// Cooks only when the cooked file is missing or older than the source
+		static bool CookIfStale(const std::string& sourcePath, const std::string& cookedPath, const TextureCookSettings& settings = {});
+
+		// Validates the container and fills in levels pointing into data
+		static bool Read(const uint8_t* data, uint64_t size, CookedTexture& texture);
+
+		static bool IsCookedPath(const std::string& path);
+	};
+
+}
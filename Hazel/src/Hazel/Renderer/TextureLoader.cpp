@@ -0,0 +1,227 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/TextureLoader.h"
+
+#include "Hazel/Core/MappedFile.h"
+#include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Hazel/Renderer/TextureCooker.h"
+#include "Platform/OpenGL/OpenGLTextureUploader.h"
+
+#include <stb_image.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace Hazel {
+
+	Scope<TextureUploader> TextureUploader::Create(uint32_t budgetBytes)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  return CreateScope<OpenGLTextureUploader>(budgetBytes);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+	struct TextureLoaderData
+	{
+		static const uint32_t DefaultUploadBudget = 4 * 1024 * 1024;
+		static const uint32_t MaxWorkers = 4;
+
+		std::vector<std::thread> Workers;
+		bool Running = false;
+
+		// Waiting to be decoded, guarded by DecodeMutex
+		std::deque<TextureUpload> DecodeQueue;
+		std::mutex DecodeMutex;
+		std::condition_variable DecodeCondition;
+
+		// Decoded by a worker, guarded by DecodedMutex
+		std::vector<TextureUpload> Decoded;
+		std::mutex DecodedMutex;
+
+		// Render thread only
+		std::deque<TextureUpload> UploadQueue;
+		Scope<TextureUploader> Uploader;
+		uint32_t UploadBudget = DefaultUploadBudget;
+
+		std::atomic<uint32_t> PendingCount = 0;
+	};
+
+	static TextureLoaderData* s_Data = nullptr;
+
+	static bool LoadCooked(TextureUpload& upload)
+	{
+		std::shared_ptr<MappedFile> file = MappedFile::Open(upload.Path);
+		CookedTexture cooked;
+		if (!file || !TextureCooker::Read(file->GetData(), file->GetSize(), cooked))
+			return false;
+
+		upload.Width = cooked.Width;
+		upload.Height = cooked.Height;
+		upload.Format = cooked.Format;
+		upload.Levels = std::move(cooked.Levels);
+		upload.Storage = file;
+
+		// Fault the pages in here rather than during the upload on the render thread
+		volatile uint8_t sink = 0;
+		for (uint64_t offset = 0; offset < file->GetSize(); offset += 4096)
+			sink += file->GetData()[offset];
+
+		return true;
+	}
+
+	static bool Decode(TextureUpload& upload)
+	{
+		int width, height, channels;
+		stbi_uc* data = nullptr;
+		{
+			HZ_PROFILE_SCOPE("stbi_load - TextureLoader");
+			data = stbi_load(upload.Path.c_str(), &width, &height, &channels, 0);
+		}
+
+		if (!data || (channels != 3 && channels != 4))
+		{
+			stbi_image_free(data);
+			return false;
+		}
+
+		upload.Width = width;
+		upload.Height = height;
+		upload.Format = channels == 4 ? TextureFormat::RGBA8 : TextureFormat::RGB8;
+		upload.Levels.push_back({ upload.Width, upload.Height, data, (uint64_t)width * height * channels });
+		upload.Storage = std::shared_ptr<void>(data, stbi_image_free);
+		return true;
+	}
+
+	static void DecodeWorker()
+	{
+		HZ_PROFILE_THREAD("Texture Decode");
+
+		while (true)
+		{
+			TextureUpload upload;
+			{
+				std::unique_lock<std::mutex> lock(s_Data->DecodeMutex);
+				s_Data->DecodeCondition.wait(lock, [] { return !s_Data->Running || !s_Data->DecodeQueue.empty(); });
+				if (!s_Data->Running)
+					return;
+
+				upload = std::move(s_Data->DecodeQueue.front());
+				s_Data->DecodeQueue.pop_front();
+			}
+
+			// Nobody is waiting for it any more
+			if (upload.Texture.expired())
+			{
+				s_Data->PendingCount--;
+				continue;
+			}
+
+			// Cooked textures are only mapped here; their pages are read during the upload
+			bool loaded = TextureCooker::IsCookedPath(upload.Path) ? LoadCooked(upload) : Decode(upload);
+			if (!loaded)
+			{
+				HZ_CORE_ERROR("Failed to load image '{0}'", upload.Path);
+				s_Data->PendingCount--;
+				continue;
+			}
+
+			std::lock_guard<std::mutex> lock(s_Data->DecodedMutex);
+			s_Data->Decoded.push_back(std::move(upload));
+		}
+	}
+
+	void TextureLoader::Init()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		s_Data = new TextureLoaderData();
+		s_Data->Uploader = TextureUploader::Create(s_Data->UploadBudget);
+
+		// The flip flag is global in stb_image; every load in the engine wants it set
+		stbi_set_flip_vertically_on_load(1);
+
+		uint32_t workerCount = std::clamp(std::thread::hardware_concurrency() / 2, 1u, TextureLoaderData::MaxWorkers);
+		s_Data->Running = true;
+		for (uint32_t i = 0; i < workerCount; i++)
+			s_Data->Workers.emplace_back(DecodeWorker);
+	}
+
+	void TextureLoader::Shutdown()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->DecodeMutex);
+			s_Data->Running = false;
+		}
+		s_Data->DecodeCondition.notify_all();
+
+		for (auto& worker : s_Data->Workers)
+			worker.join();
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void TextureLoader::Load(const Ref<Texture2D>& texture, const std::string& path)
+	{
+		s_Data->PendingCount++;
+		{
+			std::lock_guard<std::mutex> lock(s_Data->DecodeMutex);
+			TextureUpload& upload = s_Data->DecodeQueue.emplace_back();
+			upload.Texture = texture;
+			upload.Path = path;
+		}
+		s_Data->DecodeCondition.notify_one();
+	}
+
+	void TextureLoader::Update()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		{
+			std::lock_guard<std::mutex> lock(s_Data->DecodedMutex);
+			for (auto& upload : s_Data->Decoded)
+				s_Data->UploadQueue.push_back(std::move(upload));
+			s_Data->Decoded.clear();
+		}
+
+		if (s_Data->UploadQueue.empty())
+			return;
+
+		size_t queued = s_Data->UploadQueue.size();
+		s_Data->Uploader->Upload(s_Data->UploadQueue);
+		s_Data->PendingCount -= (uint32_t)(queued - s_Data->UploadQueue.size());
+
+		HZ_PROFILE_COUNTER("TextureLoader", {
+			{ "Pending", s_Data->PendingCount.load() }
+		});
+	}
+
+	void TextureLoader::SetUploadBudget(uint32_t bytesPerFrame)
+	{
+		if (bytesPerFrame == s_Data->UploadBudget)
+			return;
+
+		s_Data->UploadBudget = bytesPerFrame;
+		RenderThread::Submit([bytesPerFrame]() { s_Data->Uploader = TextureUploader::Create(bytesPerFrame); });
+	}
+
+	uint32_t TextureLoader::GetUploadBudget()
+	{
+		return s_Data->UploadBudget;
+	}
+
+	uint32_t TextureLoader::GetPendingCount()
+	{
+		return s_Data->PendingCount;
+	}
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+#include <deque>
+
+namespace Hazel {
+
+	// An image on its way to the GPU, either decoded or mapped from a cooked file.
+	// Large images are copied over several frames, a band of rows at a time.
+	struct TextureUpload
+	{
+		std::weak_ptr<Texture2D> Texture;
+		std::string Path;
+
+		uint32_t Width = 0, Height = 0;
+		TextureFormat Format = TextureFormat::None;
+		std::vector<TextureLevel> Levels;
+		// Keeps the memory the levels point into alive
+		std::shared_ptr<void> Storage;
+
+		// Progress: rows are counted in blocks for compressed formats
+		uint32_t LevelsUploaded = 0;
+		uint32_t RowsUploaded = 0;
+	};
+
+	// Copies decoded images into their textures on the render thread
+	class TextureUploader
+	{
+	public:
+		virtual ~TextureUploader() = default;
+
+		// Uploads from the front of the queue until budgetBytes are used; finished
+		// uploads are popped. Partially uploaded images stay at the front.
+		virtual void Upload(std::deque<TextureUpload>& queue) = 0;
+
+		static Scope<TextureUploader> Create(uint32_t budgetBytes);
+	};
+
+	// Loads textures created with Texture2D::CreateAsync. Image files are decoded on
+	// worker threads; Update() then uploads them on the render thread, spending no more
+	// than the upload budget per frame so a burst of loads never causes a hitch.
+	class TextureLoader
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		static void Load(const Ref<Texture2D>& texture, const std::string& path);
+
+		// Call once per frame on the render thread
+		static void Update();
+
+		static void SetUploadBudget(uint32_t bytesPerFrame);
+		static uint32_t GetUploadBudget();
+
+		// Textures still being decoded or uploaded
+		static uint32_t GetPendingCount();
+	};
+
+}
@@ -0,0 +1,191 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/TextureResidency.h"
+
+#include "Hazel/Renderer/TextureLoader.h"
+
+#include <mutex>
+
+namespace Hazel {
+
+	struct TextureResidencyData
+	{
+		static const uint64_t DefaultBudget = 1024ull * 1024 * 1024;
+
+		struct Entry
+		{
+			std::weak_ptr<Texture2D> Texture;
+			// Reload requested, waiting for the TextureLoader
+			bool Restoring = false;
+		};
+
+		std::vector<Entry> Entries;
+		// Set from the main thread while Update may be running on the render thread
+		std::atomic<uint64_t> Budget = DefaultBudget;
+		uint64_t FrameIndex = 1;
+
+		// Stats is only touched by Update; GetStats reads the copy published at its end
+		TextureResidency::Statistics Stats;
+		TextureResidency::Statistics PublishedStats;
+		std::mutex StatsMutex;
+	};
+
+	static TextureResidencyData* s_Data = nullptr;
+
+	void TextureResidency::Init()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		s_Data = new TextureResidencyData();
+	}
+
+	void TextureResidency::Shutdown()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		delete s_Data;
+		s_Data = nullptr;
+	}
+
+	void TextureResidency::Register(const Ref<Texture2D>& texture)
+	{
+		if (!s_Data || !texture)
+			return;
+
+		s_Data->Entries.push_back({ texture });
+	}
+
+	// Evicts textures not bound during the last frame, least recently bound first,
+	// until the resident size drops to target. Returns the new resident size.
+	static uint64_t EvictUntil(std::vector<Ref<Texture2D>>& textures, uint64_t residentBytes, uint64_t target)
+	{
+		if (residentBytes <= target)
+			return residentBytes;
+
+		uint64_t lastFrame = s_Data->FrameIndex - 1;
+
+		std::vector<Texture2D*> candidates;
+		for (auto& texture : textures)
+		{
+			if (texture->GetLastBindFrame() < lastFrame && texture->IsLoaded() && !texture->IsEvicted() && !texture->GetPath().empty())
+				candidates.push_back(texture.get());
+		}
+
+		std::sort(candidates.begin(), candidates.end(), [](Texture2D* a, Texture2D* b)
+		{
+			return a->GetLastBindFrame() < b->GetLastBindFrame();
+		});
+
+		for (Texture2D* texture : candidates)
+		{
+			if (residentBytes <= target)
+				break;
+
+			uint64_t size = texture->GetMemorySize();
+			if (!texture->Evict())
+				continue;
+
+			residentBytes = residentBytes - size + texture->GetMemorySize();
+			s_Data->Stats.Evictions++;
+		}
+
+		return residentBytes;
+	}
+
+	void TextureResidency::Update()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!s_Data)
+			return;
+
+		s_Data->FrameIndex++;
+		uint64_t lastFrame = s_Data->FrameIndex - 1;
+		uint64_t budget = s_Data->Budget;
+
+		auto& entries = s_Data->Entries;
+		entries.erase(std::remove_if(entries.begin(), entries.end(), [](const TextureResidencyData::Entry& entry)
+		{
+			return entry.Texture.expired();
+		}), entries.end());
+
+		std::vector<Ref<Texture2D>> textures;
+		textures.reserve(entries.size());
+		uint64_t residentBytes = 0;
+		for (auto& entry : entries)
+		{
+			Ref<Texture2D> texture = entry.Texture.lock();
+			if (entry.Restoring && texture->IsLoaded())
+				entry.Restoring = false;
+
+			residentBytes += texture->GetMemorySize();
+			textures.push_back(std::move(texture));
+		}
+
+		// Bring back evicted textures that were drawn last frame, making room if needed.
+		// If room cannot be made they keep drawing degraded and are retried next frame.
+		for (size_t i = 0; i < entries.size(); i++)
+		{
+			auto& entry = entries[i];
+			auto& texture = textures[i];
+			if (!texture->IsEvicted() || entry.Restoring || texture->GetLastBindFrame() < lastFrame)
+				continue;
+
+			uint64_t growth = texture->GetFullMemorySize();
+			if (residentBytes + growth > budget)
+				residentBytes = EvictUntil(textures, residentBytes, budget - std::min(growth, budget));
+			if (residentBytes + growth > budget)
+				continue;
+
+			TextureLoader::Load(texture, texture->GetPath());
+			entry.Restoring = true;
+			residentBytes += growth;
+			s_Data->Stats.Restores++;
+		}
+
+		residentBytes = EvictUntil(textures, residentBytes, budget);
+
+		uint32_t evictedCount = 0;
+		for (auto& texture : textures)
+		{
+			if (texture->IsEvicted())
+				evictedCount++;
+		}
+
+		s_Data->Stats.ResidentBytes = residentBytes;
+		s_Data->Stats.TextureCount = (uint32_t)textures.size();
+		s_Data->Stats.EvictedCount = evictedCount;
+
+		HZ_PROFILE_COUNTER("TextureResidency", {
+			{ "ResidentBytes", s_Data->Stats.ResidentBytes },
+			{ "BudgetBytes", budget },
+			{ "Evicted", s_Data->Stats.EvictedCount },
+			{ "Evictions", s_Data->Stats.Evictions },
+			{ "Restores", s_Data->Stats.Restores }
+		});
+
+		std::lock_guard<std::mutex> lock(s_Data->StatsMutex);
+		s_Data->PublishedStats = s_Data->Stats;
+	}
+
+	void TextureResidency::SetBudget(uint64_t bytes)
+	{
+		s_Data->Budget = bytes;
+	}
+
+	uint64_t TextureResidency::GetBudget()
+	{
+		return s_Data->Budget;
+	}
+
+	uint64_t TextureResidency::GetFrameIndex()
+	{
+		return s_Data ? s_Data->FrameIndex : 0;
+	}
+
+	TextureResidency::Statistics TextureResidency::GetStats()
+	{
+		std::lock_guard<std::mutex> lock(s_Data->StatsMutex);
+		return s_Data->PublishedStats;
+	}
+
+}
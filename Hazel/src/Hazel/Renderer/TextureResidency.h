@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Hazel/Renderer/Texture.h"
+
+namespace Hazel {
+
+	// Keeps the GPU memory used by textures under a budget. Textures loaded from a file
+	// that have not been bound recently are evicted, least recently bound first, and
+	// reloaded through the TextureLoader once they are bound again and fit.
+	class TextureResidency
+	{
+	public:
+		static void Init();
+		static void Shutdown();
+
+		// Texture2D::Create and CreateAsync register every texture they make
+		static void Register(const Ref<Texture2D>& texture);
+
+		// Call once per frame on the render thread, at a frame boundary
+		static void Update();
+
+		static void SetBudget(uint64_t bytes);
+		static uint64_t GetBudget();
+
+		// Advanced by Update; textures remember the frame they were last bound in
+		static uint64_t GetFrameIndex();
+
+		// As of the end of the last Update, so safe to read from the main thread while the
+		// render thread runs. Also recorded as a "TextureResidency" counter in the profiler
+		// trace every Update.
+		struct Statistics
+		{
+			uint64_t ResidentBytes = 0;
+			uint32_t TextureCount = 0;
+			uint32_t EvictedCount = 0;
+			// Totals since Init
+			uint32_t Evictions = 0;
+			uint32_t Restores = 0;
+		};
+		static Statistics GetStats();
+	};
+
+}
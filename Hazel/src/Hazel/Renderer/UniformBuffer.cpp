@@ -0,0 +1,22 @@
+#include "hzpch.h"
+#include "Hazel/Renderer/UniformBuffer.h"
+
+#include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
+#include "Platform/OpenGL/OpenGLUniformBuffer.h"
+
+namespace Hazel {
+
+	Ref<UniformBuffer> UniformBuffer::Create(uint32_t size, UniformBinding binding)
+	{
+		switch (Renderer::GetAPI())
+		{
+			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
+			case RendererAPI::API::OpenGL:  return RenderThread::CreateResource<OpenGLUniformBuffer>(size, (uint32_t)binding);
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
+		return nullptr;
+	}
+
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+namespace Hazel {
+
+	// Fixed binding points shared by the engine and every shader's layout(binding = N)
+	enum class UniformBinding : uint32_t
+	{
+		Camera = 0
+	};
+
+	class UniformBuffer
+	{
+	public:
+		virtual ~UniformBuffer() = default;
+
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) = 0;
+
+		static Ref<UniformBuffer> Create(uint32_t size, UniformBinding binding);
+	};
+
+}
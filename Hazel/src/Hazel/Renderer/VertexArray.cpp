@@ -2,6 +2,7 @@
 #include "Hazel/Renderer/VertexArray.h"
 
 #include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 
 namespace Hazel {
@@ -11,7 +12,7 @@ namespace Hazel {
 		switch (Renderer::GetAPI())
 		{
 			case RendererAPI::API::None:    HZ_CORE_ASSERT(false, "RendererAPI::None is currently not supported!"); return nullptr;
-			case RendererAPI::API::OpenGL:  return CreateRef<OpenGLVertexArray>();
+			case RendererAPI::API::OpenGL:  return RenderThread::CreateResource<OpenGLVertexArray>();
 		}
 
 		HZ_CORE_ASSERT(false, "Unknown RendererAPI!");
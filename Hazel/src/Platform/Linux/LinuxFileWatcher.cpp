@@ -0,0 +1,98 @@
+#include "hzpch.h"
+#include "Platform/Linux/LinuxFileWatcher.h"
+
+#include <filesystem>
+
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <errno.h>
+
+namespace Hazel {
+
+	static std::string GetAbsolutePath(const std::string& filepath)
+	{
+		return std::filesystem::absolute(filepath).lexically_normal().string();
+	}
+
+	LinuxFileWatcher::LinuxFileWatcher()
+	{
+		m_FileDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+		if (m_FileDescriptor < 0)
+			HZ_CORE_ERROR("inotify_init1 failed (errno {0}), file watching disabled", errno);
+	}
+
+	LinuxFileWatcher::~LinuxFileWatcher()
+	{
+		if (m_FileDescriptor >= 0)
+			close(m_FileDescriptor);
+	}
+
+	void LinuxFileWatcher::Watch(const std::string& filepath)
+	{
+		if (m_FileDescriptor < 0)
+			return;
+
+		std::string absolutePath = GetAbsolutePath(filepath);
+		std::string directory = std::filesystem::path(absolutePath).parent_path().string();
+
+		if (m_DirectoryWatches.find(directory) == m_DirectoryWatches.end())
+		{
+			int watch = inotify_add_watch(m_FileDescriptor, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE);
+			if (watch < 0)
+			{
+				HZ_CORE_ERROR("Could not watch directory '{0}' (errno {1})", directory, errno);
+				return;
+			}
+
+			m_DirectoryWatches[directory] = watch;
+			m_Directories[watch] = directory;
+		}
+
+		m_Files[absolutePath] = filepath;
+	}
+
+	void LinuxFileWatcher::Unwatch(const std::string& filepath)
+	{
+		// Directory watches are kept; events for files we no longer track are ignored
+		m_Files.erase(GetAbsolutePath(filepath));
+	}
+
+	std::vector<std::string> LinuxFileWatcher::Poll()
+	{
+		std::vector<std::string> changed;
+		if (m_FileDescriptor < 0)
+			return changed;
+
+		alignas(inotify_event) char buffer[4096];
+		while (true)
+		{
+			ssize_t length = read(m_FileDescriptor, buffer, sizeof(buffer));
+			if (length <= 0)
+				break; // EAGAIN: no more events queued
+
+			for (char* ptr = buffer; ptr < buffer + length; )
+			{
+				const inotify_event* event = (const inotify_event*)ptr;
+				ptr += sizeof(inotify_event) + event->len;
+
+				if (event->len == 0)
+					continue;
+
+				auto directory = m_Directories.find(event->wd);
+				if (directory == m_Directories.end())
+					continue;
+
+				auto file = m_Files.find(directory->second + "/" + event->name);
+				if (file == m_Files.end())
+					continue;
+
+				// A single save usually produces several events
+				if (std::find(changed.begin(), changed.end(), file->second) == changed.end())
+					changed.push_back(file->second);
+			}
+		}
+
+		return changed;
+	}
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "Hazel/Core/FileWatcher.h"
+
+namespace Hazel {
+
+	// inotify backend. Directories are watched rather than files, since most
+	// editors save by writing a new file and renaming it over the old one.
+	class LinuxFileWatcher : public FileWatcher
+	{
+	public:
+		LinuxFileWatcher();
+		virtual ~LinuxFileWatcher();
+
+		virtual void Watch(const std::string& filepath) override;
+		virtual void Unwatch(const std::string& filepath) override;
+
+		virtual std::vector<std::string> Poll() override;
+	private:
+		int m_FileDescriptor = -1;
+		// Watch descriptor -> absolute directory
+		std::unordered_map<int, std::string> m_Directories;
+		std::unordered_map<std::string, int> m_DirectoryWatches;
+		// Absolute path -> path as passed to Watch
+		std::unordered_map<std::string, std::string> m_Files;
+	};
+
+}
@@ -0,0 +1,48 @@
+#include "hzpch.h"
+#include "Platform/Linux/LinuxMappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace Hazel {
+
+	LinuxMappedFile::LinuxMappedFile(const std::string& filepath)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		int fd = open(filepath.c_str(), O_RDONLY);
+		if (fd < 0)
+		{
+			HZ_CORE_ERROR("Could not open file '{0}'", filepath);
+			return;
+		}
+
+		struct stat info;
+		if (fstat(fd, &info) == 0 && info.st_size > 0)
+		{
+			// The mapping keeps the file referenced, so the descriptor can go right away
+			void* data = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+			if (data != MAP_FAILED)
+			{
+				madvise(data, (size_t)info.st_size, MADV_SEQUENTIAL);
+				m_Data = (const uint8_t*)data;
+				m_Size = (uint64_t)info.st_size;
+			}
+			else
+			{
+				HZ_CORE_ERROR("Could not map file '{0}'", filepath);
+			}
+		}
+
+		close(fd);
+	}
+
+	LinuxMappedFile::~LinuxMappedFile()
+	{
+		if (m_Data)
+			munmap((void*)m_Data, (size_t)m_Size);
+	}
+
+}
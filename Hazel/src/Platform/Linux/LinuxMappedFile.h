@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Hazel/Core/MappedFile.h"
+
+namespace Hazel {
+
+	class LinuxMappedFile : public MappedFile
+	{
+	public:
+		LinuxMappedFile(const std::string& filepath);
+		virtual ~LinuxMappedFile();
+
+		virtual const uint8_t* GetData() const override { return m_Data; }
+		virtual uint64_t GetSize() const override { return m_Size; }
+	private:
+		const uint8_t* m_Data = nullptr;
+		uint64_t m_Size = 0;
+	};
+
+}
@@ -1,6 +1,8 @@
 #include "hzpch.h"
 #include "Platform/OpenGL/OpenGLBuffer.h"
 
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
 #include <glad/glad.h>
 
 namespace Hazel {
@@ -9,12 +11,46 @@ namespace Hazel {
 	// VertexBuffer /////////////////////////////////////////////////////////////
 	/////////////////////////////////////////////////////////////////////////////
 
+	static GLenum VertexBufferUsageToOpenGL(VertexBufferUsage usage)
+	{
+		switch (usage)
+		{
+			case VertexBufferUsage::Static:  return GL_STATIC_DRAW;
+			case VertexBufferUsage::Dynamic: return GL_DYNAMIC_DRAW;
+			case VertexBufferUsage::Stream:  return GL_STREAM_DRAW;
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown VertexBufferUsage!");
+		return 0;
+	}
+
+	// Full-size SetData calls a stream buffer takes per frame before its ring moves on early
+	static const uint32_t StreamWritesPerFrame = 4;
+
+	OpenGLVertexBuffer::OpenGLVertexBuffer(uint32_t size, VertexBufferUsage usage)
+		: m_Size(size)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (usage == VertexBufferUsage::Stream)
+		{
+			m_Ring = CreateScope<OpenGLRingBuffer>(size * StreamWritesPerFrame);
+			m_RendererID = m_Ring->GetRendererID();
+			return;
+		}
+
+		glCreateBuffers(1, &m_RendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		glBufferData(GL_ARRAY_BUFFER, size, nullptr, VertexBufferUsageToOpenGL(usage));
+	}
+
 	OpenGLVertexBuffer::OpenGLVertexBuffer(float* vertices, uint32_t size)
+		: m_Size(size)
 	{
 		HZ_PROFILE_FUNCTION();
 
 		glCreateBuffers(1, &m_RendererID);
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 		glBufferData(GL_ARRAY_BUFFER, size, vertices, GL_STATIC_DRAW);
 	}
 
@@ -22,6 +58,11 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
+		// The ring owns and releases its own storage
+		if (m_Ring)
+			return;
+
+		OpenGLStateCache::OnBufferDeleted(m_RendererID);
 		glDeleteBuffers(1, &m_RendererID);
 	}
 
@@ -29,14 +70,30 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 	}
 
 	void OpenGLVertexBuffer::Unbind() const
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, 0);
+	}
+
+	void OpenGLVertexBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(offset + size <= m_Size, "SetData writes past the end of the vertex buffer!");
+
+		if (m_Ring)
+		{
+			HZ_CORE_ASSERT(offset == 0, "Stream buffers must be rewritten from the start!");
+			m_DrawOffset = m_Ring->Write(data, size);
+			return;
+		}
+
+		glNamedBufferSubData(m_RendererID, offset, size, data);
 	}
 
 	/////////////////////////////////////////////////////////////////////////////
@@ -49,7 +106,7 @@ namespace Hazel {
 		HZ_PROFILE_FUNCTION();
 
 		glCreateBuffers(1, &m_RendererID);
-		glBindBuffer(GL_ARRAY_BUFFER, m_RendererID);
+		OpenGLStateCache::BindBuffer(GL_ARRAY_BUFFER, m_RendererID);
 		glBufferData(GL_ARRAY_BUFFER, count * sizeof(uint32_t), indices, GL_STATIC_DRAW);
 	}
 
@@ -57,6 +114,7 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
+		OpenGLStateCache::OnBufferDeleted(m_RendererID);
 		glDeleteBuffers(1, &m_RendererID);
 	}
 
@@ -64,14 +122,14 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
+		OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_RendererID);
 	}
 
 	void OpenGLIndexBuffer::Unbind() const
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
+		OpenGLStateCache::BindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 	}
 
 }
@@ -1,22 +1,30 @@
 #pragma once
 
 #include "Hazel/Renderer/Buffer.h"
+#include "Platform/OpenGL/OpenGLRingBuffer.h"
 
 namespace Hazel {
 
 	class OpenGLVertexBuffer : public VertexBuffer
 	{
 	public:
+		OpenGLVertexBuffer(uint32_t size, VertexBufferUsage usage);
 		OpenGLVertexBuffer(float* vertices, uint32_t size);
 		virtual ~OpenGLVertexBuffer();
 
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 
+		virtual void SetData(const void* data, uint32_t size, uint32_t offset = 0) override;
+		virtual uint32_t GetDrawOffset() const override { return m_DrawOffset; }
+
 		virtual const BufferLayout& GetLayout() const override { return m_Layout; }
 		virtual void SetLayout(const BufferLayout& layout) override { m_Layout = layout; }
 	private:
 		uint32_t m_RendererID;
+		uint32_t m_Size;
+		Scope<OpenGLRingBuffer> m_Ring;
+		uint32_t m_DrawOffset = 0;
 		BufferLayout m_Layout;
 	};
 
@@ -1,6 +1,8 @@
 #include "hzpch.h"
 #include "Platform/OpenGL/OpenGLContext.h"
 
+#include "Platform/OpenGL/OpenGLExtensions.h"
+
 #include <GLFW/glfw3.h>
 #include <glad/glad.h>
 #include <GL/GL.h>
@@ -34,6 +36,8 @@ namespace Hazel {
 
 		HZ_CORE_ASSERT(versionMajor > 4 || (versionMajor == 4 && versionMinor >= 5), "Hazel requires at least OpenGL version 4.5!");
 	#endif
+
+		OpenGLExtensions::Load((GLADloadproc)glfwGetProcAddress);
 	}
 
 	void OpenGLContext::SwapBuffers()
@@ -43,4 +47,14 @@ namespace Hazel {
 		glfwSwapBuffers(m_WindowHandle);
 	}
 
+	void OpenGLContext::MakeCurrent()
+	{
+		glfwMakeContextCurrent(m_WindowHandle);
+	}
+
+	void OpenGLContext::ReleaseCurrent()
+	{
+		glfwMakeContextCurrent(nullptr);
+	}
+
 }
\ No newline at end of file
@@ -0,0 +1,41 @@
+#include "hzpch.h"
+#include "Platform/OpenGL/OpenGLExtensions.h"
+
+namespace Hazel {
+
+	typedef void (APIENTRYP PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)(GLuint count);
+
+	bool OpenGLExtensions::s_ParallelShaderCompile = false;
+	bool OpenGLExtensions::s_TextureCompressionS3TC = false;
+
+	void OpenGLExtensions::Load(GLADloadproc loader)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		std::unordered_set<std::string> extensions;
+		GLint extensionCount = 0;
+		glGetIntegerv(GL_NUM_EXTENSIONS, &extensionCount);
+		for (GLint i = 0; i < extensionCount; i++)
+			extensions.insert((const char*)glGetStringi(GL_EXTENSIONS, i));
+
+		// The ARB version is identical apart from the entry point suffix
+		PFNGLMAXSHADERCOMPILERTHREADSKHRPROC maxShaderCompilerThreads = nullptr;
+		if (extensions.count("GL_KHR_parallel_shader_compile"))
+			maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)loader("glMaxShaderCompilerThreadsKHR");
+		else if (extensions.count("GL_ARB_parallel_shader_compile"))
+			maxShaderCompilerThreads = (PFNGLMAXSHADERCOMPILERTHREADSKHRPROC)loader("glMaxShaderCompilerThreadsARB");
+
+		if (maxShaderCompilerThreads)
+		{
+			// 0xFFFFFFFF lets the driver pick the thread count
+			maxShaderCompilerThreads(0xFFFFFFFF);
+			s_ParallelShaderCompile = true;
+		}
+
+		s_TextureCompressionS3TC = extensions.count("GL_EXT_texture_compression_s3tc") > 0;
+
+		HZ_CORE_INFO("  Parallel shader compile: {0}", s_ParallelShaderCompile ? "yes" : "no");
+		HZ_CORE_INFO("  S3TC texture compression: {0}", s_TextureCompressionS3TC ? "yes" : "no");
+	}
+
+}
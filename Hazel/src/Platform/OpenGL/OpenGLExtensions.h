@@ -0,0 +1,32 @@
+#pragma once
+
+#include <glad/glad.h>
+
+// Our Glad loader is generated for the core profile only; tokens of the
+// extensions we opt into are defined here
+#define GL_MAX_SHADER_COMPILER_THREADS_KHR 0x91B0
+#define GL_COMPLETION_STATUS_KHR           0x91B1
+
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT    0x83F0
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT   0x83F3
+
+namespace Hazel {
+
+	class OpenGLExtensions
+	{
+	public:
+		// Must be called with the context current, after Glad has been loaded
+		static void Load(GLADloadproc loader);
+
+		// GL_KHR/ARB_parallel_shader_compile: compiles and links run on driver threads
+		// and GL_COMPLETION_STATUS_KHR can be polled without blocking
+		static bool HasParallelShaderCompile() { return s_ParallelShaderCompile; }
+
+		// GL_EXT_texture_compression_s3tc: BC1 and BC3 textures
+		static bool HasTextureCompressionS3TC() { return s_TextureCompressionS3TC; }
+	private:
+		static bool s_ParallelShaderCompile;
+		static bool s_TextureCompressionS3TC;
+	};
+
+}
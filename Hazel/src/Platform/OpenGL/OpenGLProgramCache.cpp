@@ -0,0 +1,196 @@
+#include "hzpch.h"
+#include "Platform/OpenGL/OpenGLProgramCache.h"
+
+#include <filesystem>
+#include <fstream>
+#include <glad/glad.h>
+
+namespace Hazel {
+
+	static constexpr uint32_t ProgramCacheMagic = 0x42505a48; // "HZPB"
+	static constexpr uint32_t ProgramCacheVersion = 1;
+
+	struct ProgramCacheHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t BinaryFormat;
+		uint32_t BinaryLength;
+	};
+
+	static std::string s_CacheDirectory = "assets/cache/shader/opengl";
+
+	static constexpr uint64_t FNVOffsetBasis = 14695981039346656037ull;
+	static constexpr uint64_t FNVPrime = 1099511628211ull;
+
+	static uint64_t HashBytes(uint64_t hash, const void* data, size_t size)
+	{
+		const uint8_t* bytes = (const uint8_t*)data;
+		for (size_t i = 0; i < size; i++)
+		{
+			hash ^= bytes[i];
+			hash *= FNVPrime;
+		}
+		return hash;
+	}
+
+	static uint64_t HashString(uint64_t hash, const char* string)
+	{
+		// Hash the terminator too, so that adjacent strings can't run into each other
+		return HashBytes(hash, string ? string : "", string ? strlen(string) + 1 : 1);
+	}
+
+	static bool IsCacheSupported()
+	{
+		static bool supported = []()
+		{
+			GLint formatCount = 0;
+			glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+			if (formatCount == 0)
+				HZ_CORE_WARN("Driver supports no program binary formats, shader cache disabled");
+			return formatCount > 0;
+		}();
+		return supported;
+	}
+
+	static std::filesystem::path GetCachePath(uint64_t key)
+	{
+		char fileName[32];
+		snprintf(fileName, sizeof(fileName), "%016llx.glbin", (unsigned long long)key);
+		return std::filesystem::path(s_CacheDirectory) / fileName;
+	}
+
+	uint64_t OpenGLProgramCache::ComputeKey(const std::unordered_map<uint32_t, std::string>& shaderSources)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		static uint64_t driverHash = []()
+		{
+			uint64_t hash = FNVOffsetBasis;
+			hash = HashString(hash, (const char*)glGetString(GL_VENDOR));
+			hash = HashString(hash, (const char*)glGetString(GL_RENDERER));
+			hash = HashString(hash, (const char*)glGetString(GL_VERSION));
+			return hash;
+		}();
+
+		// Map iteration order is unspecified, so hash the stages in a fixed order
+		std::vector<GLenum> stages;
+		for (auto& kv : shaderSources)
+			stages.push_back(kv.first);
+		std::sort(stages.begin(), stages.end());
+
+		uint64_t hash = HashBytes(driverHash, &ProgramCacheVersion, sizeof(ProgramCacheVersion));
+		for (GLenum stage : stages)
+		{
+			hash = HashBytes(hash, &stage, sizeof(stage));
+			hash = HashString(hash, shaderSources.at(stage).c_str());
+		}
+
+		return hash;
+	}
+
+	uint32_t OpenGLProgramCache::Load(uint64_t key)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!IsCacheSupported())
+			return 0;
+
+		std::filesystem::path path = GetCachePath(key);
+		std::ifstream in(path.string(), std::ios::in | std::ios::binary);
+		if (!in)
+			return 0;
+
+		ProgramCacheHeader header;
+		in.read((char*)&header, sizeof(header));
+		if (!in || header.Magic != ProgramCacheMagic || header.Version != ProgramCacheVersion)
+		{
+			HZ_CORE_WARN("Ignoring malformed shader cache entry '{0}'", path.string());
+			return 0;
+		}
+
+		std::vector<char> binary(header.BinaryLength);
+		in.read(binary.data(), header.BinaryLength);
+		if (!in)
+		{
+			HZ_CORE_WARN("Ignoring truncated shader cache entry '{0}'", path.string());
+			return 0;
+		}
+
+		GLuint program = glCreateProgram();
+		glProgramBinary(program, header.BinaryFormat, binary.data(), (GLsizei)header.BinaryLength);
+
+		GLint isLinked = 0;
+		glGetProgramiv(program, GL_LINK_STATUS, &isLinked);
+		if (isLinked == GL_FALSE)
+		{
+			// Drivers may reject binaries for reasons the key can't capture; rebuild from source
+			HZ_CORE_WARN("Driver rejected shader cache entry '{0}', recompiling", path.string());
+			glDeleteProgram(program);
+			return 0;
+		}
+
+		return program;
+	}
+
+	void OpenGLProgramCache::Store(uint64_t key, uint32_t program)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (!IsCacheSupported())
+			return;
+
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0)
+			return;
+
+		ProgramCacheHeader header;
+		header.Magic = ProgramCacheMagic;
+		header.Version = ProgramCacheVersion;
+
+		std::vector<char> binary(length);
+		GLenum format = 0;
+		glGetProgramBinary(program, length, &length, &format, binary.data());
+		header.BinaryFormat = format;
+		header.BinaryLength = (uint32_t)length;
+
+		std::error_code error;
+		std::filesystem::create_directories(s_CacheDirectory, error);
+		if (error)
+		{
+			HZ_CORE_WARN("Could not create shader cache directory '{0}': {1}", s_CacheDirectory, error.message());
+			return;
+		}
+
+		// Write to a temporary file first so a crash never leaves a half-written entry behind
+		std::filesystem::path path = GetCachePath(key);
+		std::filesystem::path tempPath = path;
+		tempPath += ".tmp";
+		{
+			std::ofstream out(tempPath.string(), std::ios::out | std::ios::binary | std::ios::trunc);
+			out.write((const char*)&header, sizeof(header));
+			out.write(binary.data(), length);
+			if (!out)
+			{
+				HZ_CORE_WARN("Could not write shader cache entry '{0}'", path.string());
+				return;
+			}
+		}
+
+		std::filesystem::rename(tempPath, path, error);
+		if (error)
+			HZ_CORE_WARN("Could not write shader cache entry '{0}': {1}", path.string(), error.message());
+	}
+
+	void OpenGLProgramCache::SetDirectory(const std::string& directory)
+	{
+		s_CacheDirectory = directory;
+	}
+
+	const std::string& OpenGLProgramCache::GetDirectory()
+	{
+		return s_CacheDirectory;
+	}
+
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+
+namespace Hazel {
+
+	// On-disk cache of linked program binaries. Entries are keyed on the shader sources
+	// and on the driver that produced them, so a driver update simply misses the cache.
+	class OpenGLProgramCache
+	{
+	public:
+		// shaderSources maps GL shader stage enums to their source
+		static uint64_t ComputeKey(const std::unordered_map<uint32_t, std::string>& shaderSources);
+
+		// Returns a linked program, or 0 if there is no entry or the driver rejects it
+		static uint32_t Load(uint64_t key);
+		// The program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set
+		static void Store(uint64_t key, uint32_t program);
+
+		static void SetDirectory(const std::string& directory);
+		static const std::string& GetDirectory();
+	};
+
+}
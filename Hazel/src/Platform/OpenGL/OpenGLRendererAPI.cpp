@@ -1,6 +1,9 @@
 #include "hzpch.h"
 #include "Platform/OpenGL/OpenGLRendererAPI.h"
 
+#include "Platform/OpenGL/OpenGLRingBuffer.h"
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
 #include <glad/glad.h>
 
 namespace Hazel {
@@ -37,10 +40,14 @@ namespace Hazel {
 		glDebugMessageControl(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, NULL, GL_FALSE);
 	#endif
 
-		glEnable(GL_BLEND);
-		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+		OpenGLStateCache::SetBlend(true);
+		OpenGLStateCache::SetBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+		OpenGLStateCache::SetDepthTest(true);
 
-		glEnable(GL_DEPTH_TEST);
+		GLint maxTextureSlots = 0;
+		glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxTextureSlots);
+		m_MaxTextureSlots = (uint32_t)maxTextureSlots;
 	}
 
 	void OpenGLRendererAPI::SetViewport(uint32_t x, uint32_t y, uint32_t width, uint32_t height)
@@ -58,10 +65,38 @@ namespace Hazel {
 		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 	}
 
-	void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray)
+	void OpenGLRendererAPI::DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t baseVertex)
+	{
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		if (baseVertex)
+			glDrawElementsBaseVertex(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, baseVertex);
+		else
+			glDrawElements(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr);
+	}
+
+	void OpenGLRendererAPI::DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance)
+	{
+		uint32_t count = indexCount ? indexCount : vertexArray->GetIndexBuffer()->GetCount();
+		if (baseInstance)
+			glDrawElementsInstancedBaseInstance(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount, baseInstance);
+		else
+			glDrawElementsInstanced(GL_TRIANGLES, count, GL_UNSIGNED_INT, nullptr, instanceCount);
+	}
+
+	void OpenGLRendererAPI::EndFrame()
+	{
+		OpenGLRingBuffer::EndFrame();
+	}
+
+	RendererAPI::StateStatistics OpenGLRendererAPI::GetStateStatistics() const
+	{
+		const auto& stats = OpenGLStateCache::GetStats();
+		return { stats.Issued, stats.Skipped };
+	}
+
+	void OpenGLRendererAPI::ResetStateStatistics()
 	{
-		glDrawElements(GL_TRIANGLES, vertexArray->GetIndexBuffer()->GetCount(), GL_UNSIGNED_INT, nullptr);
-		glBindTexture(GL_TEXTURE_2D, 0);
+		OpenGLStateCache::ResetStats();
 	}
 
 }
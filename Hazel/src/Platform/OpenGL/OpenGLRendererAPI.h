@@ -13,7 +13,17 @@ namespace Hazel {
 		virtual void SetClearColor(const glm::vec4& color) override;
 		virtual void Clear() override;
 
-		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray) override;
+		virtual void DrawIndexed(const Ref<VertexArray>& vertexArray, uint32_t indexCount = 0, uint32_t baseVertex = 0) override;
+		virtual void DrawIndexedInstanced(const Ref<VertexArray>& vertexArray, uint32_t indexCount, uint32_t instanceCount, uint32_t baseInstance = 0) override;
+
+		virtual uint32_t GetMaxTextureSlots() const override { return m_MaxTextureSlots; }
+
+		virtual void EndFrame() override;
+
+		virtual StateStatistics GetStateStatistics() const override;
+		virtual void ResetStateStatistics() override;
+	private:
+		uint32_t m_MaxTextureSlots = 0;
 	};
 
 
@@ -0,0 +1,125 @@
+#include "hzpch.h"
+#include "Platform/OpenGL/OpenGLRingBuffer.h"
+
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
+namespace Hazel {
+
+	// Every live ring, for EndFrame; only touched on the thread that owns the GL context
+	static std::vector<OpenGLRingBuffer*> s_RingBuffers;
+
+	OpenGLRingBuffer::OpenGLRingBuffer(uint32_t segmentSize, uint32_t segmentCount)
+		: m_SegmentSize(segmentSize), m_SegmentCount(segmentCount), m_SegmentIndex(segmentCount - 1), m_Fences(segmentCount, nullptr)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(segmentSize > 0 && segmentCount > 0, "Ring buffer must not be empty!");
+
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferStorage(m_RendererID, (GLsizeiptr)segmentSize * segmentCount, nullptr, flags);
+		m_MappedData = (uint8_t*)glMapNamedBufferRange(m_RendererID, 0, (GLsizeiptr)segmentSize * segmentCount, flags);
+		HZ_CORE_ASSERT(m_MappedData, "Failed to map ring buffer!");
+
+		s_RingBuffers.push_back(this);
+	}
+
+	OpenGLRingBuffer::~OpenGLRingBuffer()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		s_RingBuffers.erase(std::find(s_RingBuffers.begin(), s_RingBuffers.end(), this));
+
+		for (GLsync fence : m_Fences)
+		{
+			if (fence)
+				glDeleteSync(fence);
+		}
+
+		glUnmapNamedBuffer(m_RendererID);
+		OpenGLStateCache::OnBufferDeleted(m_RendererID);
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	uint32_t OpenGLRingBuffer::Write(const void* data, uint32_t size)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		memcpy(Allocate(size), data, size);
+		return GetCurrentOffset();
+	}
+
+	uint8_t* OpenGLRingBuffer::Allocate(uint32_t size)
+	{
+		HZ_CORE_ASSERT(size <= m_SegmentSize, "Allocation does not fit in a ring buffer segment!");
+
+		if (!m_SegmentOpen || m_SegmentUsed + size > m_SegmentSize)
+			NextSegment();
+
+		m_CurrentOffset = m_SegmentIndex * m_SegmentSize + m_SegmentUsed;
+		m_SegmentUsed += size;
+		return m_MappedData + m_CurrentOffset;
+	}
+
+	void OpenGLRingBuffer::EndFrame()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		for (OpenGLRingBuffer* ring : s_RingBuffers)
+		{
+			if (ring->m_SegmentOpen)
+				ring->FenceSegment();
+		}
+	}
+
+	void OpenGLRingBuffer::NextSegment()
+	{
+		// Out of room mid-frame: every command reading this segment has been issued by now
+		if (m_SegmentOpen)
+			FenceSegment();
+
+		m_SegmentIndex = (m_SegmentIndex + 1) % m_SegmentCount;
+		WaitForSegment(m_SegmentIndex);
+
+		m_SegmentOpen = true;
+		m_SegmentUsed = 0;
+	}
+
+	void OpenGLRingBuffer::FenceSegment()
+	{
+		m_Fences[m_SegmentIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		m_SegmentOpen = false;
+	}
+
+	void OpenGLRingBuffer::WaitForSegment(uint32_t index)
+	{
+		GLsync& fence = m_Fences[index];
+		if (!fence)
+			return;
+
+		// Flush on the first wait so the fence is guaranteed to signal eventually
+		GLbitfield waitFlags = GL_SYNC_FLUSH_COMMANDS_BIT;
+		GLuint64 timeout = 0;
+		while (true)
+		{
+			GLenum result = glClientWaitSync(fence, waitFlags, timeout);
+			if (result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED)
+				break;
+
+			if (result == GL_WAIT_FAILED)
+			{
+				HZ_CORE_ERROR("Waiting on ring buffer fence failed!");
+				break;
+			}
+
+			HZ_PROFILE_SCOPE("OpenGLRingBuffer::WaitForSegment stall");
+			waitFlags = 0;
+			timeout = 1000000; // 1ms
+		}
+
+		glDeleteSync(fence);
+		fence = nullptr;
+	}
+
+}
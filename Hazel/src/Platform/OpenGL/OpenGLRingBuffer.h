@@ -0,0 +1,53 @@
+#pragma once
+
+#include <glad/glad.h>
+
+namespace Hazel {
+
+	// A persistently mapped buffer split into equally sized segments, one per frame in
+	// flight. Writes within a frame are packed one after another into the current segment,
+	// which is fenced once at the end of the frame, so a write only waits when the CPU
+	// gets a full ring of frames ahead of the GPU. A frame writing more than a segment
+	// holds moves on to the next one early.
+	class OpenGLRingBuffer
+	{
+	public:
+		OpenGLRingBuffer(uint32_t segmentSize, uint32_t segmentCount = 3);
+		~OpenGLRingBuffer();
+
+		OpenGLRingBuffer(const OpenGLRingBuffer&) = delete;
+		OpenGLRingBuffer& operator=(const OpenGLRingBuffer&) = delete;
+
+		// Copies data in after this frame's previous writes; returns its byte offset within
+		// the buffer, which is where draws must source it from. Offsets stay multiples of
+		// the element size as long as every write is a whole number of elements.
+		uint32_t Write(const void* data, uint32_t size);
+		// Reserves size bytes after this frame's previous writes and returns them for the
+		// caller to fill; GetCurrentOffset() is their byte offset
+		uint8_t* Allocate(uint32_t size);
+
+		// Fences the segment every ring wrote this frame. Called by the renderer once the
+		// frame's last draw has been issued.
+		static void EndFrame();
+
+		inline uint32_t GetRendererID() const { return m_RendererID; }
+		inline uint32_t GetSegmentSize() const { return m_SegmentSize; }
+		inline uint32_t GetCurrentOffset() const { return m_CurrentOffset; }
+	private:
+		void NextSegment();
+		void FenceSegment();
+		void WaitForSegment(uint32_t index);
+	private:
+		uint32_t m_RendererID = 0;
+		uint8_t* m_MappedData = nullptr;
+		uint32_t m_SegmentSize;
+		uint32_t m_SegmentCount;
+		uint32_t m_SegmentIndex;
+		// Written this frame and not fenced yet
+		bool m_SegmentOpen = false;
+		uint32_t m_SegmentUsed = 0;
+		uint32_t m_CurrentOffset = 0;
+		std::vector<GLsync> m_Fences;
+	};
+
+}
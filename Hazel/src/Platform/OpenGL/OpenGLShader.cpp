@@ -1,6 +1,13 @@
 #include "hzpch.h"
 #include "Platform/OpenGL/OpenGLShader.h"
 
+#include "Platform/OpenGL/OpenGLExtensions.h"
+#include "Platform/OpenGL/OpenGLProgramCache.h"
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
+#include "Hazel/Renderer/RenderThread.h"
+
+#include <filesystem>
 #include <fstream>
 #include <glad/glad.h>
 
@@ -19,20 +26,30 @@ namespace Hazel {
 		return 0;
 	}
 
-	OpenGLShader::OpenGLShader(const std::string& filepath)
+	OpenGLShader::OpenGLShader(const std::string& filepath, const ShaderDefines& defines, bool deferCompile)
+		: m_FilePath(filepath), m_Defines(defines)
 	{
 		HZ_PROFILE_FUNCTION();
 
-		std::string source = ReadFile(filepath);
-		auto shaderSources = PreProcess(source);
-		Compile(shaderSources);
-
 		// Extract name from filepath
 		auto lastSlash = filepath.find_last_of("/\\");
 		lastSlash = lastSlash == std::string::npos ? 0 : lastSlash + 1;
 		auto lastDot = filepath.rfind('.');
 		auto count = lastDot == std::string::npos ? filepath.size() - lastSlash : lastDot - lastSlash;
 		m_Name = filepath.substr(lastSlash, count);
+
+		std::string source = ReadFile(filepath);
+		auto shaderSources = PreProcess(source);
+		if (shaderSources.empty())
+		{
+			HZ_CORE_ERROR("Failed to load shader '{0}'", filepath);
+			return;
+		}
+
+		if (deferCompile)
+			IssueCompile(shaderSources);
+		else
+			Compile(shaderSources);
 	}
 
 	OpenGLShader::OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc)
@@ -50,6 +67,11 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
+		for (auto id : m_PendingShaderIDs)
+			glDeleteShader(id);
+		DiscardReload();
+
+		OpenGLStateCache::OnProgramDeleted(m_RendererID);
 		glDeleteProgram(m_RendererID);
 	}
 
@@ -83,6 +105,28 @@ namespace Hazel {
 		return result;
 	}
 
+	// GLSL requires #version to come first, so defines go right after it
+	static void InjectDefines(std::string& source, const ShaderDefines& defines)
+	{
+		if (defines.empty())
+			return;
+
+		std::string block;
+		for (auto& [name, value] : defines)
+			block += "#define " + name + (value.empty() ? "" : " " + value) + "\n";
+
+		size_t insertPos = 0;
+		size_t versionPos = source.find("#version");
+		if (versionPos != std::string::npos)
+		{
+			size_t eol = source.find_first_of("\r\n", versionPos);
+			insertPos = eol == std::string::npos ? source.size() : source.find_first_not_of("\r\n", eol);
+			if (insertPos == std::string::npos)
+				insertPos = source.size();
+		}
+		source.insert(insertPos, block);
+	}
+
 	std::unordered_map<GLenum, std::string> OpenGLShader::PreProcess(const std::string& source)
 	{
 		HZ_PROFILE_FUNCTION();
@@ -107,17 +151,92 @@ namespace Hazel {
 			shaderSources[ShaderTypeFromString(type)] = (pos == std::string::npos) ? source.substr(nextLinePos) : source.substr(nextLinePos, pos - nextLinePos);
 		}
 
+		m_SourceFiles = { m_FilePath };
+		for (auto& [type, stageSource] : shaderSources)
+		{
+			// Each stage is its own translation unit, so include guards reset per stage
+			std::unordered_set<std::string> included;
+			std::string resolved;
+			if (!ResolveIncludes(stageSource, m_FilePath, included, resolved))
+				return {};
+
+			stageSource = std::move(resolved);
+			InjectDefines(stageSource, m_Defines);
+		}
+
 		return shaderSources;
 	}
 
-	void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
+	// Replaces #include "path" lines, relative to the including file, with the file's contents.
+	// A file is pasted at most once per stage, which also breaks include cycles.
+	bool OpenGLShader::ResolveIncludes(const std::string& source, const std::string& filepath, std::unordered_set<std::string>& included, std::string& result)
+	{
+		const char* includeToken = "#include";
+		size_t includeTokenLength = strlen(includeToken);
+		std::filesystem::path directory = std::filesystem::path(filepath).parent_path();
+
+		result.reserve(result.size() + source.size());
+
+		size_t lineStart = 0;
+		while (lineStart < source.size())
+		{
+			size_t lineEnd = source.find('\n', lineStart);
+			lineEnd = lineEnd == std::string::npos ? source.size() : lineEnd + 1;
+
+			size_t tokenPos = source.find_first_not_of(" \t", lineStart);
+			if (tokenPos >= lineEnd || source.compare(tokenPos, includeTokenLength, includeToken) != 0)
+			{
+				result.append(source, lineStart, lineEnd - lineStart);
+				lineStart = lineEnd;
+				continue;
+			}
+
+			size_t nameBegin = source.find_first_of("\"<", tokenPos + includeTokenLength);
+			size_t nameEnd = nameBegin < lineEnd ? source.find_first_of("\">", nameBegin + 1) : std::string::npos;
+			if (nameEnd >= lineEnd)
+			{
+				HZ_CORE_ERROR("{0}: syntax error in #include", filepath);
+				return false;
+			}
+
+			std::string name = source.substr(nameBegin + 1, nameEnd - nameBegin - 1);
+
+			std::string includePath = (directory / name).lexically_normal().generic_string();
+			if (included.insert(includePath).second)
+			{
+				std::string includeSource = ReadFile(includePath);
+				if (includeSource.empty())
+				{
+					// Left in place so the GLSL compiler reports it as well
+					HZ_CORE_ERROR("{0}: could not include '{1}'", filepath, name);
+					result.append(source, lineStart, lineEnd - lineStart);
+				}
+				else
+				{
+					if (std::find(m_SourceFiles.begin(), m_SourceFiles.end(), includePath) == m_SourceFiles.end())
+						m_SourceFiles.push_back(includePath);
+
+					if (!ResolveIncludes(includeSource, includePath, included, result))
+						return false;
+					result += '\n';
+				}
+			}
+
+			lineStart = lineEnd;
+		}
+
+		return true;
+	}
+
+	// Issues compile and link without querying any status, so that with parallel
+	// compile the driver keeps working on this program while we move on
+	static GLuint IssueProgram(const std::unordered_map<GLenum, std::string>& shaderSources, std::vector<uint32_t>& shaderIDs)
 	{
 		HZ_PROFILE_FUNCTION();
 
 		GLuint program = glCreateProgram();
 		HZ_CORE_ASSERT(shaderSources.size() <= 2, "We only support 2 shaders for now");
-		std::array<GLenum, 2> glShaderIDs;
-		int glShaderIDIndex = 0;
+		shaderIDs.clear();
 		for (auto& kv : shaderSources)
 		{
 			GLenum type = kv.first;
@@ -130,37 +249,45 @@ namespace Hazel {
 
 			glCompileShader(shader);
 
-			GLint isCompiled = 0;
-			glGetShaderiv(shader, GL_COMPILE_STATUS, &isCompiled);
-			if (isCompiled == GL_FALSE)
-			{
-				GLint maxLength = 0;
-				glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &maxLength);
-
-				std::vector<GLchar> infoLog(maxLength);
-				glGetShaderInfoLog(shader, maxLength, &maxLength, &infoLog[0]);
-
-				glDeleteShader(shader);
-
-				HZ_CORE_ERROR("{0}", infoLog.data());
-				HZ_CORE_ASSERT(false, "Shader compilation failure!");
-				break;
-			}
-
 			glAttachShader(program, shader);
-			glShaderIDs[glShaderIDIndex++] = shader;
+			shaderIDs.push_back(shader);
 		}
-		
-		m_RendererID = program;
 
 		// Link our program
+		glProgramParameteri(program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
 		glLinkProgram(program);
 
+		return program;
+	}
+
+	// Waits for the link, logs any errors and releases the shader objects.
+	// On failure the program is deleted as well.
+	static bool FinishProgram(GLuint program, std::vector<uint32_t>& shaderIDs)
+	{
+		HZ_PROFILE_FUNCTION();
+
 		// Note the different functions here: glGetProgram* instead of glGetShader*.
 		GLint isLinked = 0;
 		glGetProgramiv(program, GL_LINK_STATUS, (int*)&isLinked);
 		if (isLinked == GL_FALSE)
 		{
+			// A failed compile only surfaces here, so report those first
+			for (auto id : shaderIDs)
+			{
+				GLint isCompiled = 0;
+				glGetShaderiv(id, GL_COMPILE_STATUS, &isCompiled);
+				if (isCompiled == GL_FALSE)
+				{
+					GLint maxLength = 0;
+					glGetShaderiv(id, GL_INFO_LOG_LENGTH, &maxLength);
+
+					std::vector<GLchar> infoLog(maxLength);
+					glGetShaderInfoLog(id, maxLength, &maxLength, &infoLog[0]);
+
+					HZ_CORE_ERROR("{0}", infoLog.data());
+				}
+			}
+
 			GLint maxLength = 0;
 			glGetProgramiv(program, GL_INFO_LOG_LENGTH, &maxLength);
 
@@ -171,33 +298,320 @@ namespace Hazel {
 			// We don't need the program anymore.
 			glDeleteProgram(program);
 			
-			for (auto id : glShaderIDs)
+			for (auto id : shaderIDs)
 				glDeleteShader(id);
+			shaderIDs.clear();
 
 			HZ_CORE_ERROR("{0}", infoLog.data());
+			return false;
+		}
+
+		for (auto id : shaderIDs)
+		{
+			glDetachShader(program, id);
+			glDeleteShader(id);
+		}
+		shaderIDs.clear();
+
+		return true;
+	}
+
+	static bool IsProgramComplete(GLuint program)
+	{
+		if (!OpenGLExtensions::HasParallelShaderCompile())
+			return true;
+
+		GLint completed = GL_FALSE;
+		glGetProgramiv(program, GL_COMPLETION_STATUS_KHR, &completed);
+		return completed == GL_TRUE;
+	}
+
+	void OpenGLShader::Compile(const std::unordered_map<GLenum, std::string>& shaderSources)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		IssueCompile(shaderSources);
+		FinalizeCompile();
+	}
+
+	void OpenGLShader::IssueCompile(const std::unordered_map<GLenum, std::string>& shaderSources)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		uint64_t cacheKey = OpenGLProgramCache::ComputeKey(shaderSources);
+		if (GLuint cachedProgram = OpenGLProgramCache::Load(cacheKey))
+		{
+			m_RendererID = cachedProgram;
+			ReflectUniforms();
+			return;
+		}
+
+		m_RendererID = IssueProgram(shaderSources, m_PendingShaderIDs);
+		m_PendingCacheKey = cacheKey;
+		m_CompilePending = true;
+	}
+
+	void OpenGLShader::FinalizeCompile()
+	{
+		if (!m_CompilePending)
+			return;
+
+		HZ_PROFILE_FUNCTION();
+
+		m_CompilePending = false;
+		if (!FinishProgram(m_RendererID, m_PendingShaderIDs))
+		{
+			// FinishProgram deleted the program; its name may be handed out again
+			m_RendererID = 0;
 			HZ_CORE_ASSERT(false, "Shader link failure!");
 			return;
 		}
 
-		for (auto id : glShaderIDs)
+		OpenGLProgramCache::Store(m_PendingCacheKey, m_RendererID);
+
+		ReflectUniforms();
+	}
+
+	bool OpenGLShader::IsReady() const
+	{
+		if (!m_CompilePending)
+			return true;
+
+		// The render thread owns the context while it runs
+		bool ready = false;
+		RenderThread::ExecuteSync([&]() { ready = !m_CompilePending || IsProgramComplete(m_RendererID); });
+		return ready;
+	}
+
+	void OpenGLShader::WaitUntilReady()
+	{
+		if (m_CompilePending)
+			RenderThread::ExecuteSync([this]() { FinalizeCompile(); });
+	}
+
+	bool OpenGLShader::Reload()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (m_FilePath.empty())
+			return false;
+
+		std::string source = ReadFile(m_FilePath);
+		if (source.empty())
+			return false;
+
+		auto shaderSources = PreProcess(source);
+		if (shaderSources.empty())
+		{
+			HZ_CORE_ERROR("Reloading shader '{0}' failed, keeping the previous version", m_Name);
+			return false;
+		}
+
+		// A newer edit supersedes a reload that hasn't been applied yet
+		DiscardReload();
+
+		m_ReloadCacheKey = OpenGLProgramCache::ComputeKey(shaderSources);
+		m_ReloadProgram = OpenGLProgramCache::Load(m_ReloadCacheKey);
+		m_ReloadFromCache = m_ReloadProgram != 0;
+		if (!m_ReloadProgram)
+			m_ReloadProgram = IssueProgram(shaderSources, m_ReloadShaderIDs);
+
+		return true;
+	}
+
+	bool OpenGLShader::ApplyReload()
+	{
+		if (!m_ReloadProgram)
+			return true;
+
+		if (!m_ReloadFromCache && !IsProgramComplete(m_ReloadProgram))
+			return false;
+
+		HZ_PROFILE_FUNCTION();
+
+		GLuint program = m_ReloadProgram;
+		m_ReloadProgram = 0;
+
+		if (!m_ReloadFromCache && !FinishProgram(program, m_ReloadShaderIDs))
+		{
+			HZ_CORE_ERROR("Reloading shader '{0}' failed, keeping the previous version", m_Name);
+			return true;
+		}
+
+		if (!m_ReloadFromCache)
+			OpenGLProgramCache::Store(m_ReloadCacheKey, program);
+
+		// The original compile can't be pending any more, or the old uniforms would be missing
+		FinalizeCompile();
+
+		GLuint previousProgram = m_RendererID;
+		std::vector<UniformInfo> previousUniforms = m_Uniforms;
+
+		m_RendererID = program;
+		ReflectUniforms();
+
+		// Values set once at init (sampler units, for instance) must survive the swap
+		// Handles are stable, so entries line up; uniforms new to this version have no old value
+		for (size_t i = 0; i < previousUniforms.size(); i++)
 		{
-			glDetachShader(program, id);
+			const UniformInfo& previous = previousUniforms[i];
+			const UniformInfo& current = m_Uniforms[i];
+			if (previous.Location != -1 && current.Location != -1 && previous.Type == current.Type)
+				CopyUniformValue(previousProgram, program, current.Name, current.Type, std::min(previous.Count, current.Count));
+		}
+
+		OpenGLStateCache::OnProgramDeleted(previousProgram);
+		glDeleteProgram(previousProgram);
+
+		HZ_CORE_INFO("Reloaded shader '{0}'", m_Name);
+		return true;
+	}
+
+	void OpenGLShader::DiscardReload()
+	{
+		for (auto id : m_ReloadShaderIDs)
 			glDeleteShader(id);
+		m_ReloadShaderIDs.clear();
+
+		if (m_ReloadProgram)
+			glDeleteProgram(m_ReloadProgram);
+		m_ReloadProgram = 0;
+	}
+
+	void OpenGLShader::CopyUniformValue(uint32_t sourceProgram, uint32_t destinationProgram, const std::string& name, GLenum type, int32_t count)
+	{
+		for (int32_t element = 0; element < count; element++)
+		{
+			// Array element locations aren't guaranteed to be contiguous, so look each one up
+			std::string elementName = count > 1 ? name + "[" + std::to_string(element) + "]" : name;
+			GLint source = glGetUniformLocation(sourceProgram, elementName.c_str());
+			GLint destination = glGetUniformLocation(destinationProgram, elementName.c_str());
+			if (source == -1 || destination == -1)
+				continue;
+
+			GLfloat floats[16];
+			GLint ints[4];
+			switch (type)
+			{
+				case GL_FLOAT:      glGetUniformfv(sourceProgram, source, floats); glProgramUniform1fv(destinationProgram, destination, 1, floats); break;
+				case GL_FLOAT_VEC2: glGetUniformfv(sourceProgram, source, floats); glProgramUniform2fv(destinationProgram, destination, 1, floats); break;
+				case GL_FLOAT_VEC3: glGetUniformfv(sourceProgram, source, floats); glProgramUniform3fv(destinationProgram, destination, 1, floats); break;
+				case GL_FLOAT_VEC4: glGetUniformfv(sourceProgram, source, floats); glProgramUniform4fv(destinationProgram, destination, 1, floats); break;
+				case GL_FLOAT_MAT3: glGetUniformfv(sourceProgram, source, floats); glProgramUniformMatrix3fv(destinationProgram, destination, 1, GL_FALSE, floats); break;
+				case GL_FLOAT_MAT4: glGetUniformfv(sourceProgram, source, floats); glProgramUniformMatrix4fv(destinationProgram, destination, 1, GL_FALSE, floats); break;
+				case GL_INT:
+				case GL_BOOL:
+				case GL_SAMPLER_2D:
+				case GL_SAMPLER_2D_ARRAY:
+				case GL_SAMPLER_CUBE:
+					glGetUniformiv(sourceProgram, source, ints); glProgramUniform1iv(destinationProgram, destination, 1, ints); break;
+				case GL_INT_VEC2:   glGetUniformiv(sourceProgram, source, ints); glProgramUniform2iv(destinationProgram, destination, 1, ints); break;
+				case GL_INT_VEC3:   glGetUniformiv(sourceProgram, source, ints); glProgramUniform3iv(destinationProgram, destination, 1, ints); break;
+				case GL_INT_VEC4:   glGetUniformiv(sourceProgram, source, ints); glProgramUniform4iv(destinationProgram, destination, 1, ints); break;
+				default:
+					HZ_CORE_WARN("Shader '{0}': value of uniform '{1}' not carried over by reload", m_Name, name);
+					return;
+			}
 		}
 	}
 
+	void OpenGLShader::ReflectUniforms()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		for (auto& uniform : m_Uniforms)
+			uniform.Location = -1;
+
+		GLint uniformCount = 0, maxNameLength = 0;
+		glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORMS, &uniformCount);
+		glGetProgramiv(m_RendererID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &maxNameLength);
+
+		std::vector<GLchar> nameBuffer(maxNameLength + 1);
+		for (GLint i = 0; i < uniformCount; i++)
+		{
+			GLsizei length = 0;
+			GLint count = 0;
+			GLenum type = 0;
+			glGetActiveUniform(m_RendererID, (GLuint)i, (GLsizei)nameBuffer.size(), &length, &count, &type, nameBuffer.data());
+
+			std::string name(nameBuffer.data(), length);
+			GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+			if (location == -1)
+				continue; // Uniform block members are not set through locations
+
+			// Arrays are reported as "name[0]", even with a single active element; register
+			// them under their plain name, which addresses the first element just the same
+			if (name.size() > 3 && name.compare(name.size() - 3, 3, "[0]") == 0)
+				name.resize(name.size() - 3);
+
+			UniformHandle handle = GetUniformHandle(name);
+			UniformInfo& uniform = m_Uniforms[handle];
+			uniform.Location = location;
+			uniform.Type = type;
+			uniform.Count = count;
+		}
+
+		// Names reflection doesn't list, such as single array elements, are asked for directly
+		for (auto& uniform : m_Uniforms)
+		{
+			if (uniform.Location == -1)
+				uniform.Location = QueryUniformLocation(uniform.Name);
+		}
+	}
+
+	int32_t OpenGLShader::QueryUniformLocation(const std::string& name) const
+	{
+		if (!m_RendererID || m_CompilePending)
+			return -1;
+
+		return glGetUniformLocation(m_RendererID, name.c_str());
+	}
+
+	int32_t OpenGLShader::GetUniformLocation(const std::string& name)
+	{
+		auto it = m_UniformHandles.find(name);
+		if (it != m_UniformHandles.end())
+			return m_Uniforms[it->second].Location;
+
+		// Only cached when the driver knows the name, so typos don't pile up in the table
+		int32_t location = QueryUniformLocation(name);
+		if (location != -1)
+		{
+			m_UniformHandles[name] = (UniformHandle)m_Uniforms.size();
+			m_Uniforms.push_back({ name, location });
+		}
+		return location;
+	}
+
+	UniformHandle OpenGLShader::GetUniformHandle(const std::string& name)
+	{
+		auto it = m_UniformHandles.find(name);
+		if (it != m_UniformHandles.end())
+			return it->second;
+
+		// Unknown names still get a handle so it stays valid if a later relink adds the uniform
+		UniformHandle handle = (UniformHandle)m_Uniforms.size();
+		m_Uniforms.push_back({ name, QueryUniformLocation(name) });
+		m_UniformHandles[name] = handle;
+		return handle;
+	}
+
 	void OpenGLShader::Bind() const
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glUseProgram(m_RendererID);
+		// Finishing a deferred compile doesn't change what the shader is, only when we find out
+		if (m_CompilePending)
+			const_cast<OpenGLShader*>(this)->WaitUntilReady();
+
+		OpenGLStateCache::UseProgram(m_RendererID);
 	}
 
 	void OpenGLShader::Unbind() const
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glUseProgram(0);
+		OpenGLStateCache::UseProgram(0);
 	}
 
 	void OpenGLShader::SetInt(const std::string& name, int value)
@@ -207,6 +621,13 @@ namespace Hazel {
 		UploadUniformInt(name, value);
 	}
 
+	void OpenGLShader::SetIntArray(const std::string& name, int* values, uint32_t count)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		UploadUniformIntArray(name, values, count);
+	}
+
 	void OpenGLShader::SetFloat(const std::string& name, float value)
 	{
 		HZ_PROFILE_FUNCTION();
@@ -235,45 +656,81 @@ namespace Hazel {
 		UploadUniformMat4(name, value);
 	}
 
+	void OpenGLShader::SetInt(UniformHandle handle, int value)
+	{
+		glUniform1i(GetUniformLocation(handle), value);
+	}
+
+	void OpenGLShader::SetIntArray(UniformHandle handle, int* values, uint32_t count)
+	{
+		glUniform1iv(GetUniformLocation(handle), count, values);
+	}
+
+	void OpenGLShader::SetFloat(UniformHandle handle, float value)
+	{
+		glUniform1f(GetUniformLocation(handle), value);
+	}
+
+	void OpenGLShader::SetFloat3(UniformHandle handle, const glm::vec3& value)
+	{
+		glUniform3f(GetUniformLocation(handle), value.x, value.y, value.z);
+	}
+
+	void OpenGLShader::SetFloat4(UniformHandle handle, const glm::vec4& value)
+	{
+		glUniform4f(GetUniformLocation(handle), value.x, value.y, value.z, value.w);
+	}
+
+	void OpenGLShader::SetMat4(UniformHandle handle, const glm::mat4& value)
+	{
+		glUniformMatrix4fv(GetUniformLocation(handle), 1, GL_FALSE, glm::value_ptr(value));
+	}
+
 	void OpenGLShader::UploadUniformInt(const std::string& name, int value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = GetUniformLocation(name);
 		glUniform1i(location, value);
 	}
 
+	void OpenGLShader::UploadUniformIntArray(const std::string& name, int* values, uint32_t count)
+	{
+		GLint location = GetUniformLocation(name);
+		glUniform1iv(location, count, values);
+	}
+
 	void OpenGLShader::UploadUniformFloat(const std::string& name, float value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = GetUniformLocation(name);
 		glUniform1f(location, value);
 	}
 
 	void OpenGLShader::UploadUniformFloat2(const std::string& name, const glm::vec2& value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = GetUniformLocation(name);
 		glUniform2f(location, value.x, value.y);
 	}
 
 	void OpenGLShader::UploadUniformFloat3(const std::string& name, const glm::vec3& value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = GetUniformLocation(name);
 		glUniform3f(location, value.x, value.y, value.z);
 	}
 
 	void OpenGLShader::UploadUniformFloat4(const std::string& name, const glm::vec4& value)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = GetUniformLocation(name);
 		glUniform4f(location, value.x, value.y, value.z, value.w);
 	}
 
 	void OpenGLShader::UploadUniformMat3(const std::string& name, const glm::mat3& matrix)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = GetUniformLocation(name);
 		glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
 	void OpenGLShader::UploadUniformMat4(const std::string& name, const glm::mat4& matrix)
 	{
-		GLint location = glGetUniformLocation(m_RendererID, name.c_str());
+		GLint location = GetUniformLocation(name);
 		glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(matrix));
 	}
 
@@ -3,6 +3,9 @@
 #include "Hazel/Renderer/Shader.h"
 #include <glm/glm.hpp>
 
+#include <atomic>
+#include <unordered_set>
+
 // TODO: REMOVE!
 typedef unsigned int GLenum;
 
@@ -11,22 +14,43 @@ namespace Hazel {
 	class OpenGLShader : public Shader
 	{
 	public:
-		OpenGLShader(const std::string& filepath);
+		// With deferCompile, compile and link are only issued; results are checked on first Bind
+		OpenGLShader(const std::string& filepath, const ShaderDefines& defines = {}, bool deferCompile = false);
 		OpenGLShader(const std::string& name, const std::string& vertexSrc, const std::string& fragmentSrc);
 		virtual ~OpenGLShader();
 
 		virtual void Bind() const override;
 		virtual void Unbind() const override;
 
+		virtual bool IsReady() const override;
+		virtual void WaitUntilReady() override;
+
+		virtual bool Reload() override;
+		virtual bool ApplyReload() override;
+
 		virtual void SetInt(const std::string& name, int value) override;
+		virtual void SetIntArray(const std::string& name, int* values, uint32_t count) override;
 		virtual void SetFloat(const std::string& name, float value) override;
 		virtual void SetFloat3(const std::string& name, const glm::vec3& value) override;
 		virtual void SetFloat4(const std::string& name, const glm::vec4& value) override;
 		virtual void SetMat4(const std::string& name, const glm::mat4& value) override;
 
+		virtual UniformHandle GetUniformHandle(const std::string& name) override;
+
+		virtual void SetInt(UniformHandle handle, int value) override;
+		virtual void SetIntArray(UniformHandle handle, int* values, uint32_t count) override;
+		virtual void SetFloat(UniformHandle handle, float value) override;
+		virtual void SetFloat3(UniformHandle handle, const glm::vec3& value) override;
+		virtual void SetFloat4(UniformHandle handle, const glm::vec4& value) override;
+		virtual void SetMat4(UniformHandle handle, const glm::mat4& value) override;
+
 		virtual const std::string& GetName() const override { return m_Name; }
+		virtual const std::string& GetFilePath() const override { return m_FilePath; }
+		virtual const std::vector<std::string>& GetSourceFiles() const override { return m_SourceFiles; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
 
 		void UploadUniformInt(const std::string& name, int value);
+		void UploadUniformIntArray(const std::string& name, int* values, uint32_t count);
 
 		void UploadUniformFloat(const std::string& name, float value);
 		void UploadUniformFloat2(const std::string& name, const glm::vec2& value);
@@ -38,10 +62,49 @@ namespace Hazel {
 	private:
 		std::string ReadFile(const std::string& filepath);
 		std::unordered_map<GLenum, std::string> PreProcess(const std::string& source);
+		// Appends source to result with its includes expanded; false on a malformed #include
+		bool ResolveIncludes(const std::string& source, const std::string& filepath, std::unordered_set<std::string>& included, std::string& result);
 		void Compile(const std::unordered_map<GLenum, std::string>& shaderSources);
+		void IssueCompile(const std::unordered_map<GLenum, std::string>& shaderSources);
+		void FinalizeCompile();
+		void ReflectUniforms();
+
+		void DiscardReload();
+		void CopyUniformValue(uint32_t sourceProgram, uint32_t destinationProgram, const std::string& name, GLenum type, int32_t count);
+
+		int32_t GetUniformLocation(UniformHandle handle) const { return handle >= 0 ? m_Uniforms[handle].Location : -1; }
+		// For the string setters: table first, then the driver, which also knows element and member names
+		int32_t GetUniformLocation(const std::string& name);
+		int32_t QueryUniformLocation(const std::string& name) const;
 	private:
-		uint32_t m_RendererID;
+		struct UniformInfo
+		{
+			std::string Name;
+			int32_t Location = -1;
+			GLenum Type = 0;
+			int32_t Count = 0;
+		};
+
+		uint32_t m_RendererID = 0;
 		std::string m_Name;
+		std::string m_FilePath;
+		ShaderDefines m_Defines;
+		std::vector<std::string> m_SourceFiles;
+
+		// Between IssueCompile and FinalizeCompile; read without the context by IsReady
+		std::atomic<bool> m_CompilePending = false;
+		std::vector<uint32_t> m_PendingShaderIDs;
+		uint64_t m_PendingCacheKey = 0;
+
+		// Program being built by Reload; swapped in by ApplyReload if it links
+		uint32_t m_ReloadProgram = 0;
+		std::vector<uint32_t> m_ReloadShaderIDs;
+		uint64_t m_ReloadCacheKey = 0;
+		bool m_ReloadFromCache = false;
+
+		// Handles index m_Uniforms and are never reassigned; locations are refreshed on relink
+		std::vector<UniformInfo> m_Uniforms;
+		std::unordered_map<std::string, UniformHandle> m_UniformHandles;
 	};
 
 }
\ No newline at end of file
@@ -0,0 +1,236 @@
+#include "hzpch.h"
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
+#include <glad/glad.h>
+
+namespace Hazel {
+
+	static constexpr uint32_t UnknownBinding = 0xffffffff;
+	static constexpr int8_t UnknownCapability = -1;
+
+	static constexpr uint32_t MaxCachedTextureUnits = 32;
+
+	enum BufferTargetSlot
+	{
+		ArrayBufferSlot = 0, ElementArrayBufferSlot, UniformBufferSlot, PixelUnpackBufferSlot, PixelPackBufferSlot,
+		BufferTargetSlotCount
+	};
+
+	static int BufferTargetToSlot(uint32_t target)
+	{
+		switch (target)
+		{
+			case GL_ARRAY_BUFFER:         return ArrayBufferSlot;
+			case GL_ELEMENT_ARRAY_BUFFER: return ElementArrayBufferSlot;
+			case GL_UNIFORM_BUFFER:       return UniformBufferSlot;
+			case GL_PIXEL_UNPACK_BUFFER:  return PixelUnpackBufferSlot;
+			case GL_PIXEL_PACK_BUFFER:    return PixelPackBufferSlot;
+		}
+
+		return -1;
+	}
+
+	struct OpenGLStateCacheData
+	{
+		uint32_t Program;
+		uint32_t VertexArray;
+		uint32_t Buffers[BufferTargetSlotCount];
+		uint32_t Textures[MaxCachedTextureUnits];
+
+		int8_t Blend;
+		uint32_t BlendSourceFactor;
+		uint32_t BlendDestinationFactor;
+		int8_t DepthTest;
+
+		OpenGLStateCache::Statistics Stats;
+
+		OpenGLStateCacheData()
+		{
+			Reset();
+		}
+
+		void Reset()
+		{
+			Program = UnknownBinding;
+			VertexArray = UnknownBinding;
+			for (uint32_t& binding : Buffers)
+				binding = UnknownBinding;
+			for (uint32_t& binding : Textures)
+				binding = UnknownBinding;
+
+			Blend = UnknownCapability;
+			BlendSourceFactor = UnknownBinding;
+			BlendDestinationFactor = UnknownBinding;
+			DepthTest = UnknownCapability;
+		}
+	};
+
+	static OpenGLStateCacheData s_State;
+
+	// Returns true if the call has to reach GL
+	static bool Update(uint32_t& cached, uint32_t value)
+	{
+		if (cached == value)
+		{
+			s_State.Stats.Skipped++;
+			return false;
+		}
+
+		cached = value;
+		s_State.Stats.Issued++;
+		return true;
+	}
+
+	static bool UpdateCapability(int8_t& cached, bool enabled)
+	{
+		int8_t value = enabled ? 1 : 0;
+		if (cached == value)
+		{
+			s_State.Stats.Skipped++;
+			return false;
+		}
+
+		cached = value;
+		s_State.Stats.Issued++;
+		return true;
+	}
+
+	void OpenGLStateCache::UseProgram(uint32_t program)
+	{
+		if (Update(s_State.Program, program))
+			glUseProgram(program);
+	}
+
+	void OpenGLStateCache::BindVertexArray(uint32_t vertexArray)
+	{
+		if (Update(s_State.VertexArray, vertexArray))
+		{
+			glBindVertexArray(vertexArray);
+
+			// The element array binding is part of the vertex array object
+			s_State.Buffers[ElementArrayBufferSlot] = UnknownBinding;
+		}
+	}
+
+	void OpenGLStateCache::BindBuffer(uint32_t target, uint32_t buffer)
+	{
+		int slot = BufferTargetToSlot(target);
+		if (slot < 0)
+		{
+			s_State.Stats.Issued++;
+			glBindBuffer(target, buffer);
+			return;
+		}
+
+		if (Update(s_State.Buffers[slot], buffer))
+			glBindBuffer(target, buffer);
+	}
+
+	void OpenGLStateCache::BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer)
+	{
+		s_State.Stats.Issued++;
+		glBindBufferBase(target, index, buffer);
+
+		int slot = BufferTargetToSlot(target);
+		if (slot >= 0)
+			s_State.Buffers[slot] = buffer;
+	}
+
+	void OpenGLStateCache::BindTextureUnit(uint32_t unit, uint32_t texture)
+	{
+		if (unit >= MaxCachedTextureUnits)
+		{
+			s_State.Stats.Issued++;
+			glBindTextureUnit(unit, texture);
+			return;
+		}
+
+		if (Update(s_State.Textures[unit], texture))
+			glBindTextureUnit(unit, texture);
+	}
+
+	void OpenGLStateCache::SetBlend(bool enabled)
+	{
+		if (UpdateCapability(s_State.Blend, enabled))
+		{
+			if (enabled)
+				glEnable(GL_BLEND);
+			else
+				glDisable(GL_BLEND);
+		}
+	}
+
+	void OpenGLStateCache::SetBlendFunc(uint32_t sourceFactor, uint32_t destinationFactor)
+	{
+		if (s_State.BlendSourceFactor == sourceFactor && s_State.BlendDestinationFactor == destinationFactor)
+		{
+			s_State.Stats.Skipped++;
+			return;
+		}
+
+		s_State.BlendSourceFactor = sourceFactor;
+		s_State.BlendDestinationFactor = destinationFactor;
+		s_State.Stats.Issued++;
+		glBlendFunc(sourceFactor, destinationFactor);
+	}
+
+	void OpenGLStateCache::SetDepthTest(bool enabled)
+	{
+		if (UpdateCapability(s_State.DepthTest, enabled))
+		{
+			if (enabled)
+				glEnable(GL_DEPTH_TEST);
+			else
+				glDisable(GL_DEPTH_TEST);
+		}
+	}
+
+	void OpenGLStateCache::OnProgramDeleted(uint32_t program)
+	{
+		if (s_State.Program == program)
+			s_State.Program = UnknownBinding;
+	}
+
+	void OpenGLStateCache::OnVertexArrayDeleted(uint32_t vertexArray)
+	{
+		if (s_State.VertexArray == vertexArray)
+		{
+			s_State.VertexArray = UnknownBinding;
+			s_State.Buffers[ElementArrayBufferSlot] = UnknownBinding;
+		}
+	}
+
+	void OpenGLStateCache::OnBufferDeleted(uint32_t buffer)
+	{
+		for (uint32_t& binding : s_State.Buffers)
+		{
+			if (binding == buffer)
+				binding = UnknownBinding;
+		}
+	}
+
+	void OpenGLStateCache::OnTextureDeleted(uint32_t texture)
+	{
+		for (uint32_t& binding : s_State.Textures)
+		{
+			if (binding == texture)
+				binding = UnknownBinding;
+		}
+	}
+
+	void OpenGLStateCache::Invalidate()
+	{
+		s_State.Reset();
+	}
+
+	const OpenGLStateCache::Statistics& OpenGLStateCache::GetStats()
+	{
+		return s_State.Stats;
+	}
+
+	void OpenGLStateCache::ResetStats()
+	{
+		s_State.Stats = {};
+	}
+
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace Hazel {
+
+	// Shadows the GL binding and fixed-function state of the current context so that
+	// redundant binds are filtered out before they reach the driver.
+	// All Platform/OpenGL code must change this state through here, otherwise the
+	// cache goes stale; code outside our control (e.g. ImGui) must call Invalidate().
+	class OpenGLStateCache
+	{
+	public:
+		struct Statistics
+		{
+			uint32_t Issued = 0;
+			uint32_t Skipped = 0;
+		};
+	public:
+		static void UseProgram(uint32_t program);
+		static void BindVertexArray(uint32_t vertexArray);
+		static void BindBuffer(uint32_t target, uint32_t buffer);
+		// Indexed binds are not cached, but they also replace the generic binding of target
+		static void BindBufferBase(uint32_t target, uint32_t index, uint32_t buffer);
+		static void BindTextureUnit(uint32_t unit, uint32_t texture);
+
+		static void SetBlend(bool enabled);
+		static void SetBlendFunc(uint32_t sourceFactor, uint32_t destinationFactor);
+		static void SetDepthTest(bool enabled);
+
+		// GL recycles object names, so deletions must clear any binding that refers to them
+		static void OnProgramDeleted(uint32_t program);
+		static void OnVertexArrayDeleted(uint32_t vertexArray);
+		static void OnBufferDeleted(uint32_t buffer);
+		static void OnTextureDeleted(uint32_t texture);
+
+		// Forget everything; the next change of each piece of state always reaches GL
+		static void Invalidate();
+
+		static const Statistics& GetStats();
+		static void ResetStats();
+	};
+
+}
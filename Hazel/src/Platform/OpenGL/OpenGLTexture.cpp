@@ -1,33 +1,149 @@
 #include "hzpch.h"
 #include "Platform/OpenGL/OpenGLTexture.h"
 
+#include "Platform/OpenGL/OpenGLExtensions.h"
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
+#include "Hazel/Core/MappedFile.h"
+#include "Hazel/Renderer/TextureCooker.h"
+#include "Hazel/Renderer/TextureResidency.h"
+
 #include <stb_image.h>
 
 namespace Hazel {
 
+	static GLenum ToGLInternalFormat(TextureFormat format)
+	{
+		switch (format)
+		{
+			case TextureFormat::RGB8:  return GL_RGB8;
+			case TextureFormat::RGBA8: return GL_RGBA8;
+			case TextureFormat::BC1:   return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+			case TextureFormat::BC3:   return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+		}
+
+		HZ_CORE_ASSERT(false, "Unknown texture format!");
+		return 0;
+	}
+
+	static GLenum ToGLDataFormat(TextureFormat format)
+	{
+		return format == TextureFormat::RGB8 ? GL_RGB : GL_RGBA;
+	}
+
+	static bool FormatHasAlpha(TextureFormat format)
+	{
+		return format == TextureFormat::RGBA8 || format == TextureFormat::BC3;
+	}
+
+	// Reads only the header, so deferred textures know whether they have alpha before loading
+	static bool FileHasAlpha(const std::string& path)
+	{
+		if (TextureCooker::IsCookedPath(path))
+		{
+			Scope<MappedFile> file = MappedFile::Open(path);
+			CookedTexture cooked;
+			return file && TextureCooker::Read(file->GetData(), file->GetSize(), cooked) && FormatHasAlpha(cooked.Format);
+		}
+
+		int width, height, channels;
+		return stbi_info(path.c_str(), &width, &height, &channels) && channels == 4;
+	}
+
+	// Evicting a cooked texture drops this many of its top levels, about 94% of its memory
+	static constexpr uint32_t EvictedLevelDrop = 2;
+
+	static uint64_t GetStorageSize(TextureFormat format, uint32_t width, uint32_t height, uint32_t levelCount)
+	{
+		uint64_t size = 0;
+		uint32_t blockHeight = GetFormatBlockHeight(format);
+		for (uint32_t level = 0; level < levelCount; level++)
+		{
+			uint32_t levelWidth = std::max(width >> level, 1u);
+			uint32_t levelHeight = std::max(height >> level, 1u);
+			size += (uint64_t)GetFormatRowPitch(format, levelWidth) * ((levelHeight + blockHeight - 1) / blockHeight);
+		}
+		return size;
+	}
+
+	static void CreateStorage(uint32_t& rendererID, TextureFormat format, uint32_t width, uint32_t height, uint32_t levelCount = 1)
+	{
+		glCreateTextures(GL_TEXTURE_2D, 1, &rendererID);
+		glTextureStorage2D(rendererID, levelCount, ToGLInternalFormat(format), width, height);
+
+		glTextureParameteri(rendererID, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+		glTextureParameteri(rendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+
+		glTextureParameteri(rendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
+		glTextureParameteri(rendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+	}
+
+	static void CreatePlaceholder(uint32_t& rendererID)
+	{
+		CreateStorage(rendererID, TextureFormat::RGBA8, 1, 1);
+
+		// Neutral opaque grey until the real image arrives
+		uint32_t placeholder = 0xff808080;
+		glTextureSubImage2D(rendererID, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, &placeholder);
+	}
+
+	static void UploadRegion(uint32_t rendererID, TextureFormat format, uint32_t level, uint32_t width, uint32_t y, uint32_t height, uint32_t size, const void* data)
+	{
+		// RGB rows are not 4-byte aligned
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		if (IsCompressedFormat(format))
+			glCompressedTextureSubImage2D(rendererID, level, 0, y, width, height, ToGLInternalFormat(format), size, data);
+		else
+			glTextureSubImage2D(rendererID, level, 0, y, width, height, ToGLDataFormat(format), GL_UNSIGNED_BYTE, data);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+
+	// Uncompressed formats only; rowLength is in texels
+	static void UploadSubImage(uint32_t rendererID, TextureFormat format, const TextureRegion& region, uint32_t rowLength, const void* data)
+	{
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, rowLength);
+		glTextureSubImage2D(rendererID, 0, region.X, region.Y, region.Width, region.Height, ToGLDataFormat(format), GL_UNSIGNED_BYTE, data);
+		glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+		glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+	}
+
 	OpenGLTexture2D::OpenGLTexture2D(uint32_t width, uint32_t height)
 		: m_Width(width), m_Height(height)
 	{
 		HZ_PROFILE_FUNCTION();
 
-		m_InternalFormat = GL_RGBA8;
-		m_DataFormat = GL_RGBA;
-
-		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-		glTextureStorage2D(m_RendererID, 1, m_InternalFormat, m_Width, m_Height);
+		m_Format = TextureFormat::RGBA8;
+		m_HasAlpha = true;
 
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-
-		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		CreateStorage(m_RendererID, m_Format, m_Width, m_Height);
+		m_MemorySize = m_FullMemorySize = GetStorageSize(m_Format, m_Width, m_Height, 1);
 	}
 
-	OpenGLTexture2D::OpenGLTexture2D(const std::string& path)
+	OpenGLTexture2D::OpenGLTexture2D(const std::string& path, bool deferLoad)
 		: m_Path(path)
 	{
 		HZ_PROFILE_FUNCTION();
 
+		if (deferLoad)
+		{
+			m_Width = 1;
+			m_Height = 1;
+			m_Format = TextureFormat::RGBA8;
+			m_HasAlpha = FileHasAlpha(path);
+			m_Loaded = false;
+
+			CreatePlaceholder(m_RendererID);
+			m_MemorySize = m_FullMemorySize = GetStorageSize(m_Format, 1, 1, 1);
+			return;
+		}
+
+		if (TextureCooker::IsCookedPath(path))
+		{
+			LoadCooked(path);
+			return;
+		}
+
 		int width, height, channels;
 		stbi_set_flip_vertically_on_load(1);
 		stbi_uc* data = nullptr;
@@ -39,57 +155,212 @@ namespace Hazel {
 		m_Width = width;
 		m_Height = height;
 
-		GLenum internalFormat = 0, dataFormat = 0;
+		TextureFormat format = TextureFormat::None;
 		if (channels == 4)
-		{
-			internalFormat = GL_RGBA8;
-			dataFormat = GL_RGBA;
-		}
+			format = TextureFormat::RGBA8;
 		else if (channels == 3)
+			format = TextureFormat::RGB8;
+
+		m_Format = format;
+		m_HasAlpha = FormatHasAlpha(format);
+
+		HZ_CORE_ASSERT(format != TextureFormat::None, "Format not supported!");
+
+		CreateStorage(m_RendererID, m_Format, m_Width, m_Height);
+		m_MemorySize = m_FullMemorySize = GetStorageSize(m_Format, m_Width, m_Height, 1);
+
+		UploadRegion(m_RendererID, m_Format, 0, m_Width, 0, m_Height, m_Width * m_Height * channels, data);
+
+		stbi_image_free(data);
+	}
+
+	void OpenGLTexture2D::LoadCooked(const std::string& path)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		Scope<MappedFile> file = MappedFile::Open(path);
+		CookedTexture cooked;
+		bool valid = file && TextureCooker::Read(file->GetData(), file->GetSize(), cooked);
+		HZ_CORE_ASSERT(valid, "Failed to load cooked texture!");
+		HZ_CORE_ASSERT(!IsCompressedFormat(cooked.Format) || OpenGLExtensions::HasTextureCompressionS3TC(), "Block compressed textures are not supported by this driver!");
+
+		m_Width = cooked.Width;
+		m_Height = cooked.Height;
+		m_Format = cooked.Format;
+		m_HasAlpha = FormatHasAlpha(m_Format);
+
+		m_LevelCount = (uint32_t)cooked.Levels.size();
+		CreateStorage(m_RendererID, m_Format, m_Width, m_Height, m_LevelCount);
+		m_MemorySize = m_FullMemorySize = GetStorageSize(m_Format, m_Width, m_Height, m_LevelCount);
+
+		// Straight from the mapping; the driver copies before returning
+		for (uint32_t level = 0; level < (uint32_t)cooked.Levels.size(); level++)
 		{
-			internalFormat = GL_RGB8;
-			dataFormat = GL_RGB;
+			const TextureLevel& data = cooked.Levels[level];
+			UploadRegion(m_RendererID, m_Format, level, data.Width, 0, data.Height, (uint32_t)data.Size, data.Data);
 		}
+	}
 
-		m_InternalFormat = internalFormat;
-		m_DataFormat = dataFormat;
+	OpenGLTexture2D::~OpenGLTexture2D()
+	{
+		HZ_PROFILE_FUNCTION();
 
-		HZ_CORE_ASSERT(internalFormat & dataFormat, "Format not supported!");
+		if (m_PendingRendererID)
+			glDeleteTextures(1, &m_PendingRendererID);
 
-		glCreateTextures(GL_TEXTURE_2D, 1, &m_RendererID);
-		glTextureStorage2D(m_RendererID, 1, internalFormat, m_Width, m_Height);
+		OpenGLStateCache::OnTextureDeleted(m_RendererID);
+		glDeleteTextures(1, &m_RendererID);
+	}
 
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-		glTextureParameteri(m_RendererID, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+	void OpenGLTexture2D::BeginAsyncUpload(uint32_t width, uint32_t height, TextureFormat format, uint32_t levelCount)
+	{
+		HZ_PROFILE_FUNCTION();
 
-		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTextureParameteri(m_RendererID, GL_TEXTURE_WRAP_T, GL_REPEAT);
+		HZ_CORE_ASSERT(!m_Loaded && !m_PendingRendererID, "Texture is not waiting for an upload!");
 
-		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, dataFormat, GL_UNSIGNED_BYTE, data);
+		m_PendingWidth = width;
+		m_PendingHeight = height;
+		m_PendingFormat = format;
+		m_PendingLevelCount = levelCount;
+		m_PendingMemorySize = GetStorageSize(format, width, height, levelCount);
 
-		stbi_image_free(data);
+		CreateStorage(m_PendingRendererID, m_PendingFormat, width, height, levelCount);
 	}
 
-	OpenGLTexture2D::~OpenGLTexture2D()
+	void OpenGLTexture2D::UploadPendingRegion(uint32_t level, uint32_t levelWidth, uint32_t y, uint32_t height, uint32_t size, const void* data)
+	{
+		UploadRegion(m_PendingRendererID, m_PendingFormat, level, levelWidth, y, height, size, data);
+	}
+
+	void OpenGLTexture2D::EndAsyncUpload()
 	{
 		HZ_PROFILE_FUNCTION();
 
+		OpenGLStateCache::OnTextureDeleted(m_RendererID);
 		glDeleteTextures(1, &m_RendererID);
+
+		m_RendererID = m_PendingRendererID;
+		m_Width = m_PendingWidth;
+		m_Height = m_PendingHeight;
+		m_Format = m_PendingFormat;
+		m_LevelCount = m_PendingLevelCount;
+		m_MemorySize = m_FullMemorySize = m_PendingMemorySize;
+		m_PendingRendererID = 0;
+		m_Loaded = true;
+		m_Evicted = false;
+	}
+
+	bool OpenGLTexture2D::Evict()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (m_Path.empty() || !m_Loaded || m_Evicted)
+			return false;
+
+		uint32_t rendererID = 0;
+		uint64_t memorySize = 0;
+
+		// Keep the lower mips of cooked textures: blurry until restored beats grey
+		if (m_LevelCount > EvictedLevelDrop && TextureCooker::IsCookedPath(m_Path))
+		{
+			Scope<MappedFile> file = MappedFile::Open(m_Path);
+			CookedTexture cooked;
+			if (file && TextureCooker::Read(file->GetData(), file->GetSize(), cooked) && cooked.Levels.size() == m_LevelCount)
+			{
+				uint32_t levelCount = m_LevelCount - EvictedLevelDrop;
+				const TextureLevel& base = cooked.Levels[EvictedLevelDrop];
+				CreateStorage(rendererID, m_Format, base.Width, base.Height, levelCount);
+				for (uint32_t level = 0; level < levelCount; level++)
+				{
+					const TextureLevel& data = cooked.Levels[EvictedLevelDrop + level];
+					UploadRegion(rendererID, m_Format, level, data.Width, 0, data.Height, (uint32_t)data.Size, data.Data);
+				}
+				memorySize = GetStorageSize(m_Format, base.Width, base.Height, levelCount);
+			}
+		}
+
+		if (!rendererID)
+		{
+			CreatePlaceholder(rendererID);
+			m_Format = TextureFormat::RGBA8;
+			memorySize = GetStorageSize(m_Format, 1, 1, 1);
+		}
+
+		OpenGLStateCache::OnTextureDeleted(m_RendererID);
+		glDeleteTextures(1, &m_RendererID);
+
+		m_RendererID = rendererID;
+		m_MemorySize = memorySize;
+		m_Loaded = false;
+		m_Evicted = true;
+		return true;
 	}
 
 	void OpenGLTexture2D::SetData(void* data, uint32_t size)
 	{
 		HZ_PROFILE_FUNCTION();
 
-		uint32_t bpp = m_DataFormat == GL_RGBA ? 4 : 3;
-		HZ_CORE_ASSERT(size == m_Width * m_Height * bpp, "Data must be entire texture!");
-		glTextureSubImage2D(m_RendererID, 0, 0, 0, m_Width, m_Height, m_DataFormat, GL_UNSIGNED_BYTE, data);
+		HZ_CORE_ASSERT(size == GetFormatRowPitch(m_Format, m_Width) * m_Height, "Data must be entire texture!");
+		SetData({ 0, 0, m_Width, m_Height }, data);
+	}
+
+	void OpenGLTexture2D::SetData(const TextureRegion& region, const void* data, uint32_t pitch)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(!IsCompressedFormat(m_Format), "Compressed textures cannot be written to!");
+		HZ_CORE_ASSERT(region.X + region.Width <= m_Width && region.Y + region.Height <= m_Height, "Region exceeds texture bounds!");
+
+		uint32_t texelSize = GetFormatRowPitch(m_Format, 1);
+		uint32_t rowSize = region.Width * texelSize;
+		if (pitch == 0)
+			pitch = rowSize;
+		HZ_CORE_ASSERT(pitch >= rowSize, "Row pitch is smaller than a row of the region!");
+
+		if (region.Width == 0 || region.Height == 0)
+			return;
+
+		uint32_t size = rowSize * region.Height;
+		if (m_StreamingBuffer && size <= m_StreamingBuffer->GetSegmentSize())
+		{
+			// Repacked tightly into the staging ring; the GPU copies it into the texture later
+			uint8_t* staging = m_StreamingBuffer->Allocate(size);
+			if (pitch == rowSize)
+			{
+				memcpy(staging, data, size);
+			}
+			else
+			{
+				for (uint32_t row = 0; row < region.Height; row++)
+					memcpy(staging + (size_t)row * rowSize, (const uint8_t*)data + (size_t)row * pitch, rowSize);
+			}
+
+			OpenGLStateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, m_StreamingBuffer->GetRendererID());
+			UploadSubImage(m_RendererID, m_Format, region, region.Width, (const void*)(uintptr_t)m_StreamingBuffer->GetCurrentOffset());
+			OpenGLStateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+			return;
+		}
+
+		HZ_CORE_ASSERT(pitch % texelSize == 0, "Row pitch must be a whole number of texels!");
+		UploadSubImage(m_RendererID, m_Format, region, pitch / texelSize, data);
+	}
+
+	void OpenGLTexture2D::SetStreaming(bool enabled)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		if (enabled == IsStreaming())
+			return;
+
+		HZ_CORE_ASSERT(!enabled || !IsCompressedFormat(m_Format), "Compressed textures cannot be written to!");
+		m_StreamingBuffer = enabled ? CreateScope<OpenGLRingBuffer>(GetFormatRowPitch(m_Format, m_Width) * m_Height) : nullptr;
 	}
 
 	void OpenGLTexture2D::Bind(uint32_t slot) const
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindTextureUnit(slot, m_RendererID);
+		m_LastBindFrame = TextureResidency::GetFrameIndex();
+		OpenGLStateCache::BindTextureUnit(slot, m_RendererID);
 	}
 }
\ No newline at end of file
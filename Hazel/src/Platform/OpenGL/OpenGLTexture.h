@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Hazel/Renderer/Texture.h"
+#include "Platform/OpenGL/OpenGLRingBuffer.h"
 
 #include <glad/glad.h>
 
@@ -10,20 +11,66 @@ namespace Hazel {
 	{
 	public:
 		OpenGLTexture2D(uint32_t width, uint32_t height);
-		OpenGLTexture2D(const std::string& path);
+		// Loads an image file, or a cooked .hztex with all its mip levels.
+		// With deferLoad the texture starts as a placeholder and TextureLoader fills it in.
+		OpenGLTexture2D(const std::string& path, bool deferLoad = false);
 		virtual ~OpenGLTexture2D();
 
 		virtual uint32_t GetWidth() const override { return m_Width;  }
 		virtual uint32_t GetHeight() const override { return m_Height; }
+		virtual uint32_t GetRendererID() const override { return m_RendererID; }
+
+		virtual bool HasAlpha() const override { return m_HasAlpha; }
+		virtual bool IsLoaded() const override { return m_Loaded; }
+
+		virtual uint64_t GetMemorySize() const override { return m_MemorySize + (m_PendingRendererID ? m_PendingMemorySize : 0); }
+		virtual uint64_t GetFullMemorySize() const override { return m_FullMemorySize; }
+		virtual uint64_t GetLastBindFrame() const override { return m_LastBindFrame; }
+
+		virtual const std::string& GetPath() const override { return m_Path; }
+
+		virtual bool Evict() override;
+		virtual bool IsEvicted() const override { return m_Evicted; }
 		
 		virtual void SetData(void* data, uint32_t size) override;
+		virtual void SetData(const TextureRegion& region, const void* data, uint32_t pitch = 0) override;
+
+		virtual void SetStreaming(bool enabled) override;
+		virtual bool IsStreaming() const override { return m_StreamingBuffer != nullptr; }
 
 		virtual void Bind(uint32_t slot = 0) const override;
+
+		// Deferred loading: the image goes into a second texture object that replaces
+		// the placeholder once every level has been uploaded
+		void BeginAsyncUpload(uint32_t width, uint32_t height, TextureFormat format, uint32_t levelCount);
+		// Rows [y, y + height) of a level; data is a pixel unpack buffer offset while one is bound
+		void UploadPendingRegion(uint32_t level, uint32_t levelWidth, uint32_t y, uint32_t height, uint32_t size, const void* data);
+		void EndAsyncUpload();
+	private:
+		void LoadCooked(const std::string& path);
 	private:
 		std::string m_Path;
 		uint32_t m_Width, m_Height;
 		uint32_t m_RendererID;
-		GLenum m_InternalFormat, m_DataFormat;
+		TextureFormat m_Format;
+		// Not derived from m_Format, which eviction and deferred loading change on the render thread
+		bool m_HasAlpha = false;
+		uint32_t m_LevelCount = 1;
+		bool m_Loaded = true;
+
+		uint64_t m_MemorySize = 0;
+		uint64_t m_FullMemorySize = 0;
+		mutable uint64_t m_LastBindFrame = 0;
+		bool m_Evicted = false;
+
+		// Pixel unpack ring used by SetData while streaming
+		Scope<OpenGLRingBuffer> m_StreamingBuffer;
+
+		uint32_t m_PendingRendererID = 0;
+		uint32_t m_PendingWidth = 0, m_PendingHeight = 0;
+		uint32_t m_PendingLevelCount = 0;
+		uint64_t m_PendingMemorySize = 0;
+		TextureFormat m_PendingFormat = TextureFormat::None;
 	};
 
 }
@@ -0,0 +1,88 @@
+#include "hzpch.h"
+#include "Platform/OpenGL/OpenGLTextureUploader.h"
+
+#include "Platform/OpenGL/OpenGLExtensions.h"
+#include "Platform/OpenGL/OpenGLStateCache.h"
+#include "Platform/OpenGL/OpenGLTexture.h"
+
+namespace Hazel {
+
+	OpenGLTextureUploader::OpenGLTextureUploader(uint32_t budgetBytes)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		m_StagingBuffer = CreateScope<OpenGLRingBuffer>(budgetBytes);
+	}
+
+	void OpenGLTextureUploader::Upload(std::deque<TextureUpload>& queue)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		// The whole budget, once per frame
+		uint32_t segmentSize = m_StagingBuffer->GetSegmentSize();
+		uint8_t* staging = m_StagingBuffer->Allocate(segmentSize);
+		uint32_t segmentOffset = m_StagingBuffer->GetCurrentOffset();
+		uint32_t used = 0;
+
+		OpenGLStateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, m_StagingBuffer->GetRendererID());
+
+		while (!queue.empty())
+		{
+			TextureUpload& upload = queue.front();
+
+			Ref<OpenGLTexture2D> texture = std::static_pointer_cast<OpenGLTexture2D>(upload.Texture.lock());
+			if (!texture)
+			{
+				queue.pop_front();
+				continue;
+			}
+
+			if (IsCompressedFormat(upload.Format) && !OpenGLExtensions::HasTextureCompressionS3TC())
+			{
+				HZ_CORE_ERROR("'{0}' is block compressed, which this driver does not support", upload.Path);
+				queue.pop_front();
+				continue;
+			}
+
+			const TextureLevel& level = upload.Levels[upload.LevelsUploaded];
+			uint32_t blockHeight = GetFormatBlockHeight(upload.Format);
+			uint32_t rowPitch = GetFormatRowPitch(upload.Format, level.Width);
+			uint32_t levelRows = (level.Height + blockHeight - 1) / blockHeight;
+			if (rowPitch > segmentSize)
+			{
+				HZ_CORE_ERROR("'{0}' is too wide for the texture upload budget", upload.Path);
+				queue.pop_front();
+				continue;
+			}
+
+			uint32_t rows = std::min(levelRows - upload.RowsUploaded, (segmentSize - used) / rowPitch);
+			if (rows == 0)
+				break;
+
+			if (upload.LevelsUploaded == 0 && upload.RowsUploaded == 0)
+				texture->BeginAsyncUpload(upload.Width, upload.Height, upload.Format, (uint32_t)upload.Levels.size());
+
+			uint32_t size = rows * rowPitch;
+			memcpy(staging + used, level.Data + (size_t)upload.RowsUploaded * rowPitch, size);
+
+			uint32_t y = upload.RowsUploaded * blockHeight;
+			uint32_t height = std::min(rows * blockHeight, level.Height - y);
+			texture->UploadPendingRegion(upload.LevelsUploaded, level.Width, y, height, size, (const void*)(uintptr_t)(segmentOffset + used));
+
+			used += size;
+			upload.RowsUploaded += rows;
+			if (upload.RowsUploaded == levelRows)
+			{
+				upload.RowsUploaded = 0;
+				if (++upload.LevelsUploaded == upload.Levels.size())
+				{
+					texture->EndAsyncUpload();
+					queue.pop_front();
+				}
+			}
+		}
+
+		OpenGLStateCache::BindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+	}
+
+}
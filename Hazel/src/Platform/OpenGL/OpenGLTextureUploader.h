@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Hazel/Renderer/TextureLoader.h"
+#include "Platform/OpenGL/OpenGLRingBuffer.h"
+
+namespace Hazel {
+
+	// Streams pixels through a persistently mapped pixel unpack buffer, one ring segment
+	// per frame, so glTextureSubImage2D returns without the driver copying client memory
+	class OpenGLTextureUploader : public TextureUploader
+	{
+	public:
+		OpenGLTextureUploader(uint32_t budgetBytes);
+
+		virtual void Upload(std::deque<TextureUpload>& queue) override;
+	private:
+		Scope<OpenGLRingBuffer> m_StagingBuffer;
+	};
+
+}
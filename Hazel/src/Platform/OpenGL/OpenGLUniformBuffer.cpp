@@ -0,0 +1,36 @@
+#include "hzpch.h"
+#include "Platform/OpenGL/OpenGLUniformBuffer.h"
+
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
+#include <glad/glad.h>
+
+namespace Hazel {
+
+	OpenGLUniformBuffer::OpenGLUniformBuffer(uint32_t size, uint32_t binding)
+		: m_Size(size)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		glCreateBuffers(1, &m_RendererID);
+		glNamedBufferData(m_RendererID, size, nullptr, GL_DYNAMIC_DRAW);
+		OpenGLStateCache::BindBufferBase(GL_UNIFORM_BUFFER, binding, m_RendererID);
+	}
+
+	OpenGLUniformBuffer::~OpenGLUniformBuffer()
+	{
+		HZ_PROFILE_FUNCTION();
+
+		OpenGLStateCache::OnBufferDeleted(m_RendererID);
+		glDeleteBuffers(1, &m_RendererID);
+	}
+
+	void OpenGLUniformBuffer::SetData(const void* data, uint32_t size, uint32_t offset)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HZ_CORE_ASSERT(offset + size <= m_Size, "SetData writes past the end of the uniform buffer!");
+		glNamedBufferSubData(m_RendererID, offset, size, data);
+	}
+
+}
@@ -1,6 +1,8 @@
 #include "hzpch.h"
 #include "Platform/OpenGL/OpenGLVertexArray.h"
 
+#include "Platform/OpenGL/OpenGLStateCache.h"
+
 #include <glad/glad.h>
 
 namespace Hazel {
@@ -37,6 +39,7 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
+		OpenGLStateCache::OnVertexArrayDeleted(m_RendererID);
 		glDeleteVertexArrays(1, &m_RendererID);
 	}
 
@@ -44,14 +47,14 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindVertexArray(m_RendererID);
+		OpenGLStateCache::BindVertexArray(m_RendererID);
 	}
 
 	void OpenGLVertexArray::Unbind() const
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindVertexArray(0);
+		OpenGLStateCache::BindVertexArray(0);
 	}
 
 	void OpenGLVertexArray::AddVertexBuffer(const Ref<VertexBuffer>& vertexBuffer)
@@ -60,7 +63,7 @@ namespace Hazel {
 
 		HZ_CORE_ASSERT(vertexBuffer->GetLayout().GetElements().size(), "Vertex Buffer has no layout!");
 
-		glBindVertexArray(m_RendererID);
+		OpenGLStateCache::BindVertexArray(m_RendererID);
 		vertexBuffer->Bind();
 
 		const auto& layout = vertexBuffer->GetLayout();
@@ -73,6 +76,7 @@ namespace Hazel {
 				element.Normalized ? GL_TRUE : GL_FALSE,
 				layout.GetStride(),
 				(const void*)element.Offset);
+			glVertexAttribDivisor(m_VertexBufferIndex, element.Divisor);
 			m_VertexBufferIndex++;
 		}
 
@@ -83,7 +87,7 @@ namespace Hazel {
 	{
 		HZ_PROFILE_FUNCTION();
 
-		glBindVertexArray(m_RendererID);
+		OpenGLStateCache::BindVertexArray(m_RendererID);
 		indexBuffer->Bind();
 
 		m_IndexBuffer = indexBuffer;
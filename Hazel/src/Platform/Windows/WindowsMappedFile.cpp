@@ -0,0 +1,44 @@
+#include "hzpch.h"
+#include "Platform/Windows/WindowsMappedFile.h"
+
+namespace Hazel {
+
+	WindowsMappedFile::WindowsMappedFile(const std::string& filepath)
+	{
+		HZ_PROFILE_FUNCTION();
+
+		HANDLE file = CreateFileA(filepath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			HZ_CORE_ERROR("Could not open file '{0}'", filepath);
+			return;
+		}
+		m_File = file;
+
+		LARGE_INTEGER size;
+		if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+			return;
+
+		m_Mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (!m_Mapping)
+		{
+			HZ_CORE_ERROR("Could not map file '{0}'", filepath);
+			return;
+		}
+
+		m_Data = (const uint8_t*)MapViewOfFile(m_Mapping, FILE_MAP_READ, 0, 0, 0);
+		if (m_Data)
+			m_Size = (uint64_t)size.QuadPart;
+	}
+
+	WindowsMappedFile::~WindowsMappedFile()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+		if (m_Mapping)
+			CloseHandle(m_Mapping);
+		if (m_File)
+			CloseHandle(m_File);
+	}
+
+}
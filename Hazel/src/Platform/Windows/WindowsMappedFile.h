@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Hazel/Core/MappedFile.h"
+
+namespace Hazel {
+
+	class WindowsMappedFile : public MappedFile
+	{
+	public:
+		WindowsMappedFile(const std::string& filepath);
+		virtual ~WindowsMappedFile();
+
+		virtual const uint8_t* GetData() const override { return m_Data; }
+		virtual uint64_t GetSize() const override { return m_Size; }
+	private:
+		void* m_File = nullptr;
+		void* m_Mapping = nullptr;
+		const uint8_t* m_Data = nullptr;
+		uint64_t m_Size = 0;
+	};
+
+}
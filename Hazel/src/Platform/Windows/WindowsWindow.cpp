@@ -8,6 +8,7 @@
 #include "Hazel/Events/KeyEvent.h"
 
 #include "Hazel/Renderer/Renderer.h"
+#include "Hazel/Renderer/RenderThread.h"
 
 #include "Platform/OpenGL/OpenGLContext.h"
 
@@ -177,17 +178,18 @@ namespace Hazel {
 		HZ_PROFILE_FUNCTION();
 
 		glfwPollEvents();
-		m_Context->SwapBuffers();
+
+		// Last command of the frame; with a render thread the swap blocks there instead
+		GraphicsContext* context = m_Context.get();
+		RenderThread::Submit([context]() { context->SwapBuffers(); });
 	}
 
 	void WindowsWindow::SetVSync(bool enabled)
 	{
 		HZ_PROFILE_FUNCTION();
 
-		if (enabled)
-			glfwSwapInterval(1);
-		else
-			glfwSwapInterval(0);
+		// The swap interval belongs to the context, which the render thread may own
+		RenderThread::Submit([enabled]() { glfwSwapInterval(enabled ? 1 : 0); });
 
 		m_Data.VSync = enabled;
 	}
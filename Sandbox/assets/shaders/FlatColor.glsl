@@ -1,11 +1,12 @@
 // Flat Color Shader
 
 #type vertex
-#version 330 core
+#version 450 core
 
 layout(location = 0) in vec3 a_Position;
 
-uniform mat4 u_ViewProjection;
+#include "include/Camera.glsl"
+
 uniform mat4 u_Transform;
 
 void main()
@@ -14,7 +15,7 @@ void main()
 }
 
 #type fragment
-#version 330 core
+#version 450 core
 
 layout(location = 0) out vec4 color;
 
@@ -1,34 +1,112 @@
 // Basic Texture Shader
+// Define INSTANCED for the variant that expands per-instance quads
 
 #type vertex
-#version 330 core
+#version 450 core
 
-layout(location = 0) in vec3 a_Position;
+#ifdef INSTANCED
+// Shared unit quad
+layout(location = 0) in vec2 a_Position;
 layout(location = 1) in vec2 a_TexCoord;
 
-uniform mat4 u_ViewProjection;
-uniform mat4 u_Transform;
+// Per-instance attributes
+layout(location = 2) in vec3 i_Position;
+layout(location = 3) in vec2 i_Size;
+layout(location = 4) in float i_Rotation;
+layout(location = 5) in vec4 i_Color;
+layout(location = 6) in vec4 i_TexRect; // min.xy, max.xy
+layout(location = 7) in float i_TexIndex;
+layout(location = 8) in float i_TilingFactor;
+#else
+layout(location = 0) in vec3 a_Position;
+layout(location = 1) in vec4 a_Color;
+layout(location = 2) in vec2 a_TexCoord;
+layout(location = 3) in float a_TexIndex;
+layout(location = 4) in float a_TilingFactor;
+#endif
+
+#include "include/Camera.glsl"
 
+out vec4 v_Color;
 out vec2 v_TexCoord;
+flat out float v_TexIndex;
+out float v_TilingFactor;
 
 void main()
 {
+#ifdef INSTANCED
+	vec2 local = a_Position * i_Size;
+	float c = cos(i_Rotation);
+	float s = sin(i_Rotation);
+	vec3 position = i_Position + vec3(local.x * c - local.y * s, local.x * s + local.y * c, 0.0);
+
+	v_Color = i_Color;
+	v_TexCoord = mix(i_TexRect.xy, i_TexRect.zw, a_TexCoord);
+	v_TexIndex = i_TexIndex;
+	v_TilingFactor = i_TilingFactor;
+	gl_Position = u_ViewProjection * vec4(position, 1.0);
+#else
+	v_Color = a_Color;
 	v_TexCoord = a_TexCoord;
-	gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);
+	v_TexIndex = a_TexIndex;
+	v_TilingFactor = a_TilingFactor;
+	gl_Position = u_ViewProjection * vec4(a_Position, 1.0);
+#endif
 }
 
 #type fragment
-#version 330 core
+#version 450 core
 
 layout(location = 0) out vec4 color;
 
+in vec4 v_Color;
 in vec2 v_TexCoord;
+flat in float v_TexIndex;
+in float v_TilingFactor;
 
-uniform vec4 u_Color;
-uniform float u_TilingFactor;
-uniform sampler2D u_Texture;
+uniform sampler2D u_Textures[32];
 
 void main()
 {
-	color = texture(u_Texture, v_TexCoord * u_TilingFactor) * u_Color;
+	vec2 texCoord = v_TexCoord * v_TilingFactor;
+
+	// Sampler arrays may only be indexed with dynamically uniform expressions,
+	// so select the slot with a switch rather than u_Textures[int(v_TexIndex)]
+	vec4 texColor = v_Color;
+	switch (int(v_TexIndex))
+	{
+		case  0: texColor *= texture(u_Textures[ 0], texCoord); break;
+		case  1: texColor *= texture(u_Textures[ 1], texCoord); break;
+		case  2: texColor *= texture(u_Textures[ 2], texCoord); break;
+		case  3: texColor *= texture(u_Textures[ 3], texCoord); break;
+		case  4: texColor *= texture(u_Textures[ 4], texCoord); break;
+		case  5: texColor *= texture(u_Textures[ 5], texCoord); break;
+		case  6: texColor *= texture(u_Textures[ 6], texCoord); break;
+		case  7: texColor *= texture(u_Textures[ 7], texCoord); break;
+		case  8: texColor *= texture(u_Textures[ 8], texCoord); break;
+		case  9: texColor *= texture(u_Textures[ 9], texCoord); break;
+		case 10: texColor *= texture(u_Textures[10], texCoord); break;
+		case 11: texColor *= texture(u_Textures[11], texCoord); break;
+		case 12: texColor *= texture(u_Textures[12], texCoord); break;
+		case 13: texColor *= texture(u_Textures[13], texCoord); break;
+		case 14: texColor *= texture(u_Textures[14], texCoord); break;
+		case 15: texColor *= texture(u_Textures[15], texCoord); break;
+		case 16: texColor *= texture(u_Textures[16], texCoord); break;
+		case 17: texColor *= texture(u_Textures[17], texCoord); break;
+		case 18: texColor *= texture(u_Textures[18], texCoord); break;
+		case 19: texColor *= texture(u_Textures[19], texCoord); break;
+		case 20: texColor *= texture(u_Textures[20], texCoord); break;
+		case 21: texColor *= texture(u_Textures[21], texCoord); break;
+		case 22: texColor *= texture(u_Textures[22], texCoord); break;
+		case 23: texColor *= texture(u_Textures[23], texCoord); break;
+		case 24: texColor *= texture(u_Textures[24], texCoord); break;
+		case 25: texColor *= texture(u_Textures[25], texCoord); break;
+		case 26: texColor *= texture(u_Textures[26], texCoord); break;
+		case 27: texColor *= texture(u_Textures[27], texCoord); break;
+		case 28: texColor *= texture(u_Textures[28], texCoord); break;
+		case 29: texColor *= texture(u_Textures[29], texCoord); break;
+		case 30: texColor *= texture(u_Textures[30], texCoord); break;
+		case 31: texColor *= texture(u_Textures[31], texCoord); break;
+	}
+	color = texColor;
 }
\ No newline at end of file
@@ -0,0 +1,6 @@
+// Camera block shared by every shader, bound at UniformBinding::Camera
+
+layout(std140, binding = 0) uniform Camera
+{
+	mat4 u_ViewProjection;
+};
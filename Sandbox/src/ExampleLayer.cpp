@@ -49,12 +49,16 @@ ExampleLayer::ExampleLayer()
 	m_SquareVA->SetIndexBuffer(squareIB);
 
 	std::string vertexSrc = R"(
-			#version 330 core
+			#version 450 core
 			
 			layout(location = 0) in vec3 a_Position;
 			layout(location = 1) in vec4 a_Color;
 
-			uniform mat4 u_ViewProjection;
+			layout(std140, binding = 0) uniform Camera
+			{
+				mat4 u_ViewProjection;
+			};
+
 			uniform mat4 u_Transform;
 
 			out vec3 v_Position;
@@ -69,7 +73,7 @@ ExampleLayer::ExampleLayer()
 		)";
 
 	std::string fragmentSrc = R"(
-			#version 330 core
+			#version 450 core
 			
 			layout(location = 0) out vec4 color;
 
@@ -86,11 +90,15 @@ ExampleLayer::ExampleLayer()
 	m_Shader = Hazel::Shader::Create("VertexPosColor", vertexSrc, fragmentSrc);
 
 	std::string flatColorShaderVertexSrc = R"(
-			#version 330 core
+			#version 450 core
 			
 			layout(location = 0) in vec3 a_Position;
 
-			uniform mat4 u_ViewProjection;
+			layout(std140, binding = 0) uniform Camera
+			{
+				mat4 u_ViewProjection;
+			};
+
 			uniform mat4 u_Transform;
 
 			out vec3 v_Position;
@@ -103,7 +111,7 @@ ExampleLayer::ExampleLayer()
 		)";
 
 	std::string flatColorShaderFragmentSrc = R"(
-			#version 330 core
+			#version 450 core
 			
 			layout(location = 0) out vec4 color;
 
@@ -119,7 +127,46 @@ ExampleLayer::ExampleLayer()
 
 	m_FlatColorShader = Hazel::Shader::Create("FlatColor", flatColorShaderVertexSrc, flatColorShaderFragmentSrc);
 
-	auto textureShader = m_ShaderLibrary.Load("assets/shaders/Texture.glsl");
+	std::string textureShaderVertexSrc = R"(
+			#version 450 core
+			
+			layout(location = 0) in vec3 a_Position;
+			layout(location = 1) in vec2 a_TexCoord;
+
+			layout(std140, binding = 0) uniform Camera
+			{
+				mat4 u_ViewProjection;
+			};
+
+			uniform mat4 u_Transform;
+
+			out vec2 v_TexCoord;
+
+			void main()
+			{
+				v_TexCoord = a_TexCoord;
+				gl_Position = u_ViewProjection * u_Transform * vec4(a_Position, 1.0);	
+			}
+		)";
+
+	std::string textureShaderFragmentSrc = R"(
+			#version 450 core
+			
+			layout(location = 0) out vec4 color;
+
+			in vec2 v_TexCoord;
+			
+			uniform sampler2D u_Texture;
+
+			void main()
+			{
+				color = texture(u_Texture, v_TexCoord);
+			}
+		)";
+
+	// Renderer2D's batched Texture.glsl expects per-vertex color and tiling, so this layer keeps its own
+	auto textureShader = Hazel::Shader::Create("Texture", textureShaderVertexSrc, textureShaderFragmentSrc);
+	m_ShaderLibrary.Add(textureShader);
 
 	m_Texture = Hazel::Texture2D::Create("assets/textures/Checkerboard.png");
 	m_ChernoLogoTexture = Hazel::Texture2D::Create("assets/textures/ChernoLogo.png");
@@ -149,8 +196,11 @@ void ExampleLayer::OnUpdate(Hazel::Timestep ts)
 
 	glm::mat4 scale = glm::scale(glm::mat4(1.0f), glm::vec3(0.1f));
 
-	m_FlatColorShader->Bind();
-	m_FlatColorShader->SetFloat3("u_Color", m_SquareColor);
+	Hazel::RenderThread::Submit([shader = m_FlatColorShader, color = m_SquareColor]()
+	{
+		shader->Bind();
+		shader->SetFloat3("u_Color", color);
+	});
 
 	for (int y = 0; y < 20; y++)
 	{
@@ -164,10 +214,8 @@ void ExampleLayer::OnUpdate(Hazel::Timestep ts)
 
 	auto textureShader = m_ShaderLibrary.Get("Texture");
 
-	m_Texture->Bind();
-	Hazel::Renderer::Submit(textureShader, m_SquareVA, glm::scale(glm::mat4(1.0f), glm::vec3(1.5f)));
-	m_ChernoLogoTexture->Bind();
-	Hazel::Renderer::Submit(textureShader, m_SquareVA, glm::scale(glm::mat4(1.0f), glm::vec3(1.5f)));
+	Hazel::Renderer::Submit(textureShader, m_SquareVA, glm::scale(glm::mat4(1.0f), glm::vec3(1.5f)), m_Texture);
+	Hazel::Renderer::Submit(textureShader, m_SquareVA, glm::scale(glm::mat4(1.0f), glm::vec3(1.5f)), m_ChernoLogoTexture);
 
 	// Triangle
 	// Hazel::Renderer::Submit(m_Shader, m_VertexArray);
@@ -13,12 +13,16 @@ void Sandbox2D::OnAttach()
 {
 	HZ_PROFILE_FUNCTION();
 
-	m_CheckerboardTexture = Hazel::Texture2D::Create("assets/textures/Checkerboard.png");
+	// Tiled 10x below, so it needs mips to minify cleanly
+	Hazel::TextureCooker::CookIfStale("assets/textures/Checkerboard.png", "assets/cache/textures/Checkerboard.hztex");
+	m_CheckerboardTexture = Hazel::AssetManager::LoadTexture("assets/cache/textures/Checkerboard.hztex");
 }
 
 void Sandbox2D::OnDetach()
 {
 	HZ_PROFILE_FUNCTION();
+
+	Hazel::AssetManager::Release(m_CheckerboardTexture);
 }
 
 void Sandbox2D::OnUpdate(Hazel::Timestep ts)
@@ -29,6 +33,7 @@ void Sandbox2D::OnUpdate(Hazel::Timestep ts)
 	m_CameraController.OnUpdate(ts);
 
 	// Render
+	Hazel::Renderer2D::ResetStats();
 	{
 		HZ_PROFILE_SCOPE("Renderer Prep");
 		Hazel::RenderCommand::SetClearColor({ 0.1f, 0.1f, 0.1f, 1 });
@@ -50,7 +55,38 @@ void Sandbox2D::OnImGuiRender()
 	HZ_PROFILE_FUNCTION();
 
 	ImGui::Begin("Settings");
+
+	auto stats = Hazel::Renderer2D::GetStats();
+	ImGui::Text("Renderer2D Stats:");
+	ImGui::Text("Draw Calls: %d", stats.DrawCalls);
+	ImGui::Text("Quads: %d", stats.QuadCount);
+	ImGui::Text("Vertices: %d", stats.GetTotalVertexCount());
+	ImGui::Text("Indices: %d", stats.GetTotalIndexCount());
+	ImGui::Text("Texture Slots Used: %d", stats.TextureSlotsUsed);
+	ImGui::Text("Batch Flushes: %d full, %d out of texture slots", stats.QuadBufferFlushes, stats.TextureSlotFlushes);
+
+	auto stateStats = Hazel::Renderer::GetStateStatistics();
+	ImGui::Text("GL State Changes (last frame): %d issued, %d skipped", stateStats.Issued, stateStats.Skipped);
+
+	auto residencyStats = Hazel::TextureResidency::GetStats();
+	ImGui::Text("Texture Memory: %.1f / %.1f MB, %d of %d evicted", residencyStats.ResidentBytes / (1024.0f * 1024.0f),
+		Hazel::TextureResidency::GetBudget() / (1024.0f * 1024.0f), residencyStats.EvictedCount, residencyStats.TextureCount);
+
+	ImGui::Separator();
 	ImGui::ColorEdit4("Square Color", glm::value_ptr(m_SquareColor));
+
+	bool instancing = Hazel::Renderer2D::IsInstancing();
+	if (ImGui::Checkbox("Instanced Quads", &instancing))
+		Hazel::Renderer2D::SetInstancing(instancing);
+
+	Hazel::Application& app = Hazel::Application::Get();
+	int frameLimit = (int)app.GetTargetFrameRate();
+	if (ImGui::SliderInt("Frame Limit (0 = off)", &frameLimit, 0, 240))
+		app.SetTargetFrameRate((uint32_t)frameLimit);
+
+	const auto& limiterStats = app.GetFrameLimiterStats();
+	ImGui::Text("Frame Pacing: %.3f ms avg jitter, %.3f ms max, %d missed", limiterStats.AverageJitter,
+		limiterStats.MaxJitter, (int)limiterStats.MissedDeadlines);
 	ImGui::End();
 }
 
@@ -21,7 +21,7 @@ private:
 	Hazel::Ref<Hazel::VertexArray> m_SquareVA;
 	Hazel::Ref<Hazel::Shader> m_FlatColorShader;
 
-	Hazel::Ref<Hazel::Texture2D> m_CheckerboardTexture;
+	Hazel::AssetHandle m_CheckerboardTexture = Hazel::InvalidAssetHandle;
 
 	glm::vec4 m_SquareColor = { 0.2f, 0.3f, 0.8f, 1.0f };
 };
\ No newline at end of file
@@ -75,7 +75,8 @@ project "Hazel"
 		"GLFW",
 		"Glad",
 		"ImGui",
-		"opengl32.lib"
+		"opengl32.lib",
+		"winmm.lib"
 	}
 
 	filter "system:windows"
@@ -87,6 +88,11 @@ project "Hazel"
 			"GLFW_INCLUDE_NONE"
 		}
 
+		removefiles
+		{
+			"%{prj.name}/src/Platform/Linux/**"
+		}
+
 	filter "configurations:Debug"
 		defines "HZ_DEBUG"
 		runtime "Debug"